@@ -34,6 +34,7 @@
 #include "../Time/TimeEffects.h"
 #include "../Time/DayNightController.h"
 #include "../World/VoxelChunk.h"  // For accessing voxel data
+#include "../World/MeshWorkerPool.h"
 
 // External systems
 extern TimeEffects* g_timeEffects;
@@ -80,6 +81,13 @@ GameClient::GameClient()
 
         client->onEntityStateUpdate = [this](const EntityStateUpdate& update)
         { this->handleEntityStateUpdate(update); };
+
+        client->onIslandSplitReceived = [this](const IslandSplitHeader& header, const std::vector<Vec3>& chunkCoords,
+                                               const std::vector<uint8_t>& chunkVoxels)
+        { this->handleIslandSplitReceived(header, chunkCoords, chunkVoxels); };
+
+        client->onChunkUnloadReceived = [this](uint32_t islandID, const std::vector<Vec3>& chunkCoords)
+        { this->handleChunkUnloadReceived(islandID, chunkCoords); };
     }
 }
 
@@ -236,6 +244,12 @@ bool GameClient::update(float deltaTime)
         processInput(deltaTime);
     }
 
+    // Remesh every chunk touched this frame once (a local game state is flushed by the server tick)
+    if (m_isRemoteClient && m_gameState)
+    {
+        m_gameState->getIslandSystem()->flushDirtyChunks();
+    }
+
     // Render frame
     {
         PROFILE_SCOPE("render");
@@ -266,6 +280,13 @@ void GameClient::shutdown()
     // Disconnect from game state
     m_gameState = nullptr;
 
+    // Stop meshing before the renderer its results are uploaded to
+    if (g_meshWorkerPool)
+    {
+        g_meshWorkerPool->shutdown();
+        g_meshWorkerPool.reset();
+    }
+
     // Cleanup renderers (unique_ptr handles deletion automatically)
     if (g_mdiRenderer)
     {
@@ -439,6 +460,10 @@ bool GameClient::initializeGraphics()
         std::cout << "✅ MDI Renderer initialized - ready for massive batching!" << std::endl;
     }
 
+    // Background chunk meshing - results are published on this thread each frame
+    g_meshWorkerPool = std::make_unique<MeshWorkerPool>();
+    g_meshWorkerPool->initialize();
+
     // Initialize model instancing renderer (decorative GLB like grass)
     g_modelRenderer = std::make_unique<ModelInstanceRenderer>();
     if (!g_modelRenderer->initialize())
@@ -818,6 +843,12 @@ void GameClient::renderWorld()
         return;
     }
     
+    // Swap in meshes finished by the worker pool (queues their MDI uploads below)
+    if (g_meshWorkerPool)
+    {
+        g_meshWorkerPool->publishCompleted();
+    }
+    
     // Process pending mesh updates from game logic thread (MUST be on render thread for OpenGL)
     if (g_mdiRenderer)
     {
@@ -867,6 +898,25 @@ void GameClient::renderWorld()
                       << (stats.totalVertices / 1000) << "k verts, " 
                       << stats.drawCalls << " draw call(s), "
                       << stats.lastFrameTimeMs << "ms" << std::endl;
+            if (stats.activeChunks > 0)
+            {
+                // Vertex memory per chunk (GPU slice + CPU mesh copy each hold one set)
+                const size_t vertsPerChunk = stats.totalVertices / stats.activeChunks;
+                std::cout << "   Vertex memory: " << (vertsPerChunk * sizeof(Vertex)) / 1024.0f
+                          << " KB/chunk packed vs " << (vertsPerChunk * Vertex::UNPACKED_SIZE) / 1024.0f
+                          << " KB/chunk unpacked (" << sizeof(Vertex) << " vs " << Vertex::UNPACKED_SIZE
+                          << " bytes/vertex)" << std::endl;
+            }
+            if (g_meshWorkerPool)
+            {
+                auto meshStats = g_meshWorkerPool->getStatistics();
+                std::cout << "🧵 Meshing: " << meshStats.published << " published, "
+                          << meshStats.cancelled << " cancelled, " << meshStats.pending << " pending ("
+                          << meshStats.workers << " workers)" << std::endl;
+                auto remeshStats = m_gameState->getIslandSystem()->getRemeshStats();
+                std::cout << "🧱 Remesh: " << remeshStats.executed << " executed, "
+                          << remeshStats.coalesced() << " coalesced" << std::endl;
+            }
             lastPrint = now;
         }
         
@@ -1097,6 +1147,9 @@ void GameClient::handleWorldStateReceived(const WorldStateMessage& worldState)
         return;
     }
 
+    // Server-fed chunks mesh on the worker pool - voxel writes happen on this (render) thread
+    m_gameState->getIslandSystem()->setBackgroundMeshing(true);
+
     // Spawn player at server-provided location
     m_playerController.setPosition(worldState.playerSpawnPosition);
 }
@@ -1131,8 +1184,8 @@ void GameClient::handleCompressedIslandReceived(uint32_t islandID, const Vec3& p
     {
         // Create the main chunk if it doesn't exist (client islands don't auto-generate chunks)
         // For backward compatibility, use the origin chunk (0,0,0)
-        Vec3 originChunk(0, 0, 0);
-        if (island->chunks.find(originChunk) == island->chunks.end())
+        ChunkCoord originChunk(0, 0, 0);
+        if (!island->chunks.contains(originChunk))
         {
             islandSystem->addChunkToIsland(localIslandID, originChunk);
         }
@@ -1142,8 +1195,7 @@ void GameClient::handleCompressedIslandReceived(uint32_t islandID, const Vec3& p
         {
             // Apply the voxel data directly - this replaces any procedural generation
             chunk->setRawVoxelData(voxelData, dataSize);
-            chunk->generateMesh();
-            chunk->buildCollisionMesh();
+            islandSystem->markChunkDirty(chunk);
         }
         else
         {
@@ -1190,37 +1242,27 @@ void GameClient::handleCompressedChunkReceived(uint32_t islandID, const Vec3& ch
         std::cout << "📦 Created new island " << islandID << " from server" << std::endl;
     }
 
-    // Add chunk to island if it doesn't exist
-    VoxelChunk* chunk = islandSystem->getChunkFromIsland(islandID, chunkCoord);
+    // Add chunk to island if it doesn't exist (wire format carries the coord as Vec3)
+    const ChunkCoord coord = ChunkCoord::fromVec3(chunkCoord);
+    VoxelChunk* chunk = islandSystem->getChunkFromIsland(islandID, coord);
     if (!chunk)
     {
-        islandSystem->addChunkToIsland(islandID, chunkCoord);
-        chunk = islandSystem->getChunkFromIsland(islandID, chunkCoord);
+        islandSystem->addChunkToIsland(islandID, coord);
+        chunk = islandSystem->getChunkFromIsland(islandID, coord);
     }
 
     if (chunk)
     {
         // Apply the voxel data directly
         chunk->setRawVoxelData(voxelData, dataSize);
-        chunk->generateMesh();
-        chunk->buildCollisionMesh();
+        islandSystem->markChunkDirty(chunk);
         
         // DEFERRED INTER-CHUNK CULLING: Regenerate all 6 neighbors
-        // This allows them to cull faces that touch this new chunk
-        static const Vec3 neighborOffsets[6] = {
-            Vec3(0, -1, 0), Vec3(0, 1, 0),   // -Y, +Y
-            Vec3(0, 0, -1), Vec3(0, 0, 1),   // -Z, +Z
-            Vec3(-1, 0, 0), Vec3(1, 0, 0)    // -X, +X
-        };
-        
-        for (int i = 0; i < 6; ++i)
+        // This allows them to cull faces that touch this new chunk (a burst of adjacent
+        // chunks in one frame remeshes each chunk once at the frame's flush)
+        for (int face = 0; face < 6; ++face)
         {
-            Vec3 neighborCoord = chunkCoord + neighborOffsets[i];
-            VoxelChunk* neighbor = islandSystem->getChunkFromIsland(islandID, neighborCoord);
-            if (neighbor)
-            {
-                neighbor->generateMesh();
-            }
+            islandSystem->markChunkDirty(chunk->getNeighbor(face));
         }
         
         // Don't register with MDI here - syncPhysicsToChunks() will handle it
@@ -1233,6 +1275,39 @@ void GameClient::handleCompressedChunkReceived(uint32_t islandID, const Vec3& ch
     }
 }
 
+void GameClient::handleChunkUnloadReceived(uint32_t islandID, const std::vector<Vec3>& chunkCoords)
+{
+    if (!m_gameState)
+        return;
+    auto* islandSystem = m_gameState->getIslandSystem();
+    if (!islandSystem || !islandSystem->getIsland(islandID))
+        return;
+
+    std::vector<ChunkCoord> exposed;  // Neighbors that meshed against a dropped chunk
+    exposed.reserve(chunkCoords.size() * 6);
+    for (const Vec3& wireCoord : chunkCoords)
+    {
+        const ChunkCoord coord = ChunkCoord::fromVec3(wireCoord);
+        VoxelChunk* chunk = islandSystem->getChunkFromIsland(islandID, coord);
+        if (!chunk)
+            continue;
+
+        // Renderers hold the pointer - let go of it before the chunk is destroyed
+        if (g_mdiRenderer)
+            g_mdiRenderer->releaseChunk(chunk);
+        if (g_modelRenderer)
+            g_modelRenderer->removeChunk(chunk);
+        islandSystem->removeChunkFromIsland(islandID, coord);
+
+        exposed.insert(exposed.end(), {coord + ChunkCoord(0, -1, 0), coord + ChunkCoord(0, 1, 0), coord + ChunkCoord(0, 0, -1),
+                                       coord + ChunkCoord(0, 0, 1), coord + ChunkCoord(-1, 0, 0), coord + ChunkCoord(1, 0, 0)});
+    }
+
+    // Faces toward the dropped chunks were culled - remesh whatever is still loaded next to them
+    for (const ChunkCoord& coord : exposed)
+        islandSystem->markChunkDirty(islandSystem->getChunkFromIsland(islandID, coord));
+}
+
 void GameClient::handleVoxelChangeReceived(const VoxelChangeUpdate& update)
 {
     if (!m_gameState)
@@ -1242,30 +1317,9 @@ void GameClient::handleVoxelChangeReceived(const VoxelChangeUpdate& update)
     }
 
     // Apply the authoritative voxel change from server
+    // Remesh is flushed once per frame to the worker pool; publishCompleted() queues the MDI update
     m_gameState->setVoxel(update.islandID, update.localPos, update.voxelType);
 
-    // Update MDI renderer (client-side only - server doesn't render)
-    if (g_mdiRenderer)
-    {
-        auto* islandSystem = m_gameState->getIslandSystem();
-        Vec3 chunkCoord = FloatingIsland::islandPosToChunkCoord(update.localPos);
-        auto* chunk = islandSystem->getChunkFromIsland(update.islandID, chunkCoord);
-        auto* island = islandSystem->getIsland(update.islandID);
-        if (chunk && island)
-        {
-            if (chunk->getMDIIndex() < 0)
-            {
-                // Chunk not yet registered - syncPhysicsToChunks() will handle registration
-                // with correct transform after EntityStateUpdate sets authoritative position
-            }
-            else
-            {
-                // Existing chunk - update mesh
-                g_mdiRenderer->queueChunkMeshUpdate(chunk->getMDIIndex(), chunk);
-            }
-        }
-    }
-
     // **FIXED**: Always force immediate raycast update when server sends voxel changes
     // This ensures block selection is immediately accurate after server updates
     m_inputState.cachedTargetBlock = VoxelRaycaster::raycast(
@@ -1273,6 +1327,51 @@ void GameClient::handleVoxelChangeReceived(const VoxelChangeUpdate& update)
     m_inputState.raycastTimer = 0.0f;
 }
 
+void GameClient::handleIslandSplitReceived(const IslandSplitHeader& header, const std::vector<Vec3>& chunkCoords,
+                                           const std::vector<uint8_t>& chunkVoxels)
+{
+    if (!m_gameState)
+    {
+        std::cerr << "Cannot apply island split: no game state!" << std::endl;
+        return;
+    }
+
+    auto* islandSystem = m_gameState->getIslandSystem();
+    if (!islandSystem)
+    {
+        std::cerr << "No island system available" << std::endl;
+        return;
+    }
+
+    // The break first, then the fragment moves out in whole chunks (remeshed at the frame's flush)
+    m_gameState->setVoxel(header.sourceIslandID, header.brokenVoxelPos, 0);
+
+    std::vector<ChunkCoord> sourceChunkCoords;
+    sourceChunkCoords.reserve(chunkCoords.size());
+    for (const Vec3& chunkCoord : chunkCoords)
+        sourceChunkCoords.push_back(ChunkCoord::fromVec3(chunkCoord));
+
+    uint32_t fragmentID = islandSystem->splitChunksToNewIsland(header.sourceIslandID, sourceChunkCoords, chunkVoxels.data(),
+                                                               ChunkCoord::fromVec3(header.chunkOffset),
+                                                               header.fragmentIslandID);
+    FloatingIsland* fragment = islandSystem->getIsland(fragmentID);
+    if (!fragment)
+    {
+        std::cerr << "Failed to apply split of island " << header.sourceIslandID << std::endl;
+        return;
+    }
+    fragment->setPose(header.fragmentPosition, header.fragmentRotation);
+    fragment->velocity = header.fragmentVelocity;
+    fragment->angularVelocity = header.fragmentAngularVelocity;
+
+    std::cout << "🌊 Island " << header.sourceIslandID << " split: fragment island " << fragmentID << " ("
+              << chunkCoords.size() << " chunks)" << std::endl;
+
+    m_inputState.cachedTargetBlock = VoxelRaycaster::raycast(
+        m_playerController.getCamera().position, m_playerController.getCamera().front, 50.0f, islandSystem);
+    m_inputState.raycastTimer = 0.0f;
+}
+
 void GameClient::handleEntityStateUpdate(const EntityStateUpdate& update)
 {
     if (!m_gameState)
@@ -1294,7 +1393,7 @@ void GameClient::handleEntityStateUpdate(const EntityStateUpdate& update)
                     // Apply server-authoritative velocity for client-side physics simulation
                     // This allows smooth movement while maintaining server authority
 
-                    Vec3 currentPos = island->physicsCenter;
+                    Vec3 currentPos = island->getPhysicsCenter();
                     Vec3 serverPos = update.position;
                     Vec3 positionError = serverPos - currentPos;
 
@@ -1308,14 +1407,14 @@ void GameClient::handleEntityStateUpdate(const EntityStateUpdate& update)
                     island->acceleration = update.acceleration;
                     
                     // Set rotation from server (server-authoritative)
-                    island->rotation = update.rotation;
+                    island->setRotation(update.rotation);
                     island->angularVelocity = update.angularVelocity;
 
                     // Apply position correction based on error magnitude
                     if (errorMagnitude > 2.0f)
                     {
                         // Large error: snap to server position (teleport/respawn case)
-                        island->physicsCenter = serverPos;
+                        island->setPhysicsCenter(serverPos);
                     }
                     else if (errorMagnitude > 0.1f)
                     {
@@ -216,6 +216,16 @@ private:
      */
     void handleVoxelChangeReceived(const VoxelChangeUpdate& update);
     
+    /**
+     * Handle an island split from server (block break + fragment chunks)
+     */
+    void handleIslandSplitReceived(const IslandSplitHeader& header, const std::vector<Vec3>& chunkCoords, const std::vector<uint8_t>& chunkVoxels);
+    
+    /**
+     * Handle chunks that left the streaming range (server will resend them when they return)
+     */
+    void handleChunkUnloadReceived(uint32_t islandID, const std::vector<Vec3>& chunkCoords);
+    
     /**
      * Handle received entity state updates from server
      */
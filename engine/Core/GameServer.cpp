@@ -19,21 +19,27 @@ GameServer::~GameServer()
     shutdown();
 }
 
-bool GameServer::initialize(float targetTickRate, bool enableNetworking, uint16_t networkPort)
+bool GameServer::initialize(float targetTickRate, bool enableNetworking, uint16_t networkPort, bool headless)
 {
     // Removed verbose debug output
 
     m_targetTickRate = targetTickRate;
     m_fixedDeltaTime = 1.0f / targetTickRate;
     m_networkingEnabled = enableNetworking;
+    m_headless = headless;
 
     // Initialize time manager
     m_timeManager = std::make_unique<TimeManager>();
 
     // Initialize game state
     m_gameState = std::make_unique<GameState>();
-    if (!m_gameState->initialize(true))
-    {  // Create default world
+    if (m_headless)
+    {
+        // Nothing is drawn on a dedicated server - skip render mesh, AO, light maps and model instances
+        m_gameState->getIslandSystem()->setChunkProfile(ChunkProfile::Lean);
+    }
+    if (!m_gameState->initialize(true, m_worldDirectory, m_regenerateWorld))
+    {  // Create default world (or load the saved one)
         std::cerr << "Failed to initialize game state!" << std::endl;
         return false;
     }
@@ -71,6 +77,25 @@ bool GameServer::initialize(float targetTickRate, bool enableNetworking, uint16_
 
             server->onPilotingInput = [this](ENetPeer* peer, const PilotingInputMessage& input)
             { this->handlePilotingInput(peer, input); };
+
+            // Player positions drive chunk streaming - the network manager still validates and relays them
+            auto relayMovement = server->onPlayerMovementRequest;
+            server->onPlayerMovementRequest = [this, relayMovement](ENetPeer* peer, const PlayerMovementRequest& request)
+            {
+                auto it = m_clientStreams.find(peer);
+                if (it != m_clientStreams.end())
+                    it->second.position = request.intendedPosition;
+                if (relayMovement)
+                    relayMovement(peer, request);
+            };
+
+            auto reportDisconnect = server->onClientDisconnected;
+            server->onClientDisconnected = [this, reportDisconnect](ENetPeer* peer)
+            {
+                m_clientStreams.erase(peer);
+                if (reportDisconnect)
+                    reportDisconnect(peer);
+            };
         }
 
         // Removed verbose debug output
@@ -134,6 +159,7 @@ void GameServer::shutdown()
     // Clear command queues
     m_pendingVoxelChanges.clear();
     m_pendingPlayerMovements.clear();
+    m_clientStreams.clear();
 
     // Shutdown systems
     if (m_gameState)
@@ -232,6 +258,14 @@ void GameServer::processTick(float deltaTime)
         m_networkManager->update();
     }
 
+    // Remesh chunks edited this tick (queued commands + network requests) once each,
+    // so simulation below collides against up-to-date meshes
+    if (m_gameState)
+    {
+        PROFILE_SCOPE("flushDirtyChunks");
+        m_gameState->getIslandSystem()->flushDirtyChunks();
+    }
+
     // Update time manager
     if (m_timeManager)
     {
@@ -252,6 +286,28 @@ void GameServer::processTick(float deltaTime)
         PROFILE_SCOPE("broadcastIslandStates");
         broadcastIslandStates();
     }
+
+    // Working set follows the players (generate, page in, evict), new nearby chunks go to clients
+    if (m_gameState)
+    {
+        m_timeSinceStreaming += deltaTime;
+        if (m_timeSinceStreaming >= STREAMING_INTERVAL)
+        {
+            updateStreaming();
+        }
+    }
+
+    // Periodic autosave (dirty chunks only - usually a handful)
+    if (m_gameState && m_gameState->getWorldSave())
+    {
+        m_timeSinceAutosave += deltaTime;
+        if (m_timeSinceAutosave >= AUTOSAVE_INTERVAL)
+        {
+            PROFILE_SCOPE("GameState::saveWorld");
+            m_timeSinceAutosave = 0.0f;
+            m_gameState->saveWorld();
+        }
+    }
 }
 
 void GameServer::processQueuedCommands()
@@ -338,30 +394,91 @@ void GameServer::sendWorldStateToClient(ENetPeer* peer)
     // Send basic world state first
     server->sendWorldStateToClient(peer, worldState);
 
-    // Now send compressed voxel data for ALL islands
-    std::cout << "[SERVER] Sending " << islandIDs.size() << " islands to client..." << std::endl;
-    for (size_t i = 0; i < islandIDs.size(); i++)
+    // Chunks follow through streaming: whatever lies within render distance of the player,
+    // generated or paged in first if need be. Until its first movement the player is at the spawn.
+    m_clientStreams[peer].position = worldState.playerSpawnPosition;
+    updateStreaming();
+}
+
+void GameServer::updateStreaming()
+{
+    PROFILE_SCOPE("GameServer::updateStreaming");
+    m_timeSinceStreaming = 0.0f;
+
+    // No players = empty working set: with a save directory everything goes back to disk
+    std::vector<Vec3> playerPositions;
+    playerPositions.reserve(m_clientStreams.size());
+    for (const auto& [peer, stream] : m_clientStreams)
+        playerPositions.push_back(stream.position);
+    m_gameState->updateStreaming(playerPositions);
+
+    for (const auto& [peer, stream] : m_clientStreams)
+        streamChunksToClient(peer);
+}
+
+void GameServer::streamChunksToClient(ENetPeer* peer)
+{
+    auto server = m_networkManager ? m_networkManager->getServer() : nullptr;
+    auto streamIt = m_clientStreams.find(peer);
+    if (!server || streamIt == m_clientStreams.end())
+        return;
+    ClientStream& stream = streamIt->second;
+
+    IslandChunkSystem* islandSystem = m_gameState->getIslandSystem();
+
+    // Drop chunks the player left behind - forgetting them means they're re-sent on return
+    const int keepRadius = islandSystem->getRenderDistance() + UNLOAD_MARGIN;
+    size_t unloaded = 0;
+    for (auto it = stream.sentChunks.begin(); it != stream.sentChunks.end();)
     {
-        const FloatingIsland* island = islandSystem->getIsland(islandIDs[i]);
-        if (island)
+        const FloatingIsland* island = islandSystem->getIsland(it->first);
+        if (!island)
         {
-            std::cout << "[SERVER] Sending island " << (i+1) << "/" << islandIDs.size() 
-                      << " (ID=" << islandIDs[i] << ", " << island->chunks.size() << " chunks)" << std::endl;
-            
-            // Send all chunks for this island
-            for (const auto& [chunkCoord, chunk] : island->chunks)
-            {
-                if (chunk)
-                {
-                    const uint8_t* voxelData = chunk->getRawVoxelData();
-                    uint32_t voxelDataSize = chunk->getVoxelDataSize();
+            it = stream.sentChunks.erase(it);
+            continue;
+        }
 
-                    // Use the new sendCompressedChunkToClient method with chunk coordinates
-                    server->sendCompressedChunkToClient(peer, islandIDs[i], chunkCoord, worldState.islandPositions[i], voxelData, voxelDataSize);
-                }
-            }
+        const ChunkCoord center = FloatingIsland::voxelToChunkCoord(
+            ChunkCoord::fromVec3(island->worldToLocal(stream.position)));
+        std::vector<Vec3> farChunks;
+        it->second.forEach([&](const ChunkCoord& chunkCoord) {
+            const ChunkCoord d = chunkCoord - center;
+            if (d.x * d.x + d.y * d.y + d.z * d.z > keepRadius * keepRadius)
+                farChunks.push_back(chunkCoord.toVec3());
+        });
+        if (!farChunks.empty())
+        {
+            for (const Vec3& chunkCoord : farChunks)
+                it->second.erase(ChunkCoord::fromVec3(chunkCoord));
+            server->sendChunkUnloadToClient(peer, it->first, farChunks);
+            unloaded += farChunks.size();
         }
+        ++it;
+    }
+    if (unloaded > 0)
+        std::cout << "[SERVER] Unloaded " << unloaded << " chunks on client" << std::endl;
+
+    std::vector<IslandChunkSystem::ChunkInRange> nearby;
+    islandSystem->getChunksInRange(stream.position, nearby);
+
+    size_t sent = 0;
+    for (const IslandChunkSystem::ChunkInRange& entry : nearby)
+    {
+        // Later edits reach the client as voxel changes - each chunk is sent once
+        if (!stream.sentChunks[entry.islandID].insert(entry.chunkCoord))
+            continue;
+
+        // Decode palette storage into a scratch buffer (no per-chunk decode cache kept alive)
+        uint8_t voxelData[VoxelChunk::VOLUME];
+        entry.chunk->copyRawVoxelData(voxelData);
+        server->sendCompressedChunkToClient(peer, entry.islandID, entry.chunkCoord.toVec3(),
+                                           islandSystem->getIslandCenter(entry.islandID), voxelData,
+                                           entry.chunk->getVoxelDataSize());
+        ++sent;
     }
+
+    if (sent > 0)
+        std::cout << "[SERVER] Streamed " << sent << " chunks to client" << std::endl;
 }
 
 void GameServer::handleVoxelChangeRequest(ENetPeer* peer, const VoxelChangeRequest& request)
@@ -391,74 +508,58 @@ void GameServer::handleVoxelChangeRequest(ENetPeer* peer, const VoxelChangeReque
             try
             {
                 Vec3 fragmentAnchor;
-                if (ConnectivityAnalyzer::wouldBreakingCauseSplit(island, request.localPos, fragmentAnchor))
+                if (ConnectivityAnalyzer::wouldBreakingCauseSplit(island, islandSystem->getStreamSource(),
+                                                              request.localPos, fragmentAnchor))
                 {
                     std::cout << "🌊 Block break will cause island split! Extracting fragment..." << std::endl;
                     
                     // Remove the block first
                     m_gameState->setVoxel(request.islandID, request.localPos, request.voxelType);
                     
-                    // Extract the fragment to a new island
-                    std::vector<Vec3> removedVoxels;
+                    // Move the fragment to a new island in whole chunks
+                    FragmentChunks fragment;
                     uint32_t newIslandID = ConnectivityAnalyzer::extractFragmentToNewIsland(
-                        islandSystem, request.islandID, fragmentAnchor, &removedVoxels);
+                        islandSystem, request.islandID, fragmentAnchor, &fragment);
                     
+                    auto server = m_networkManager->getServer();
                     if (newIslandID != 0)
                     {
                         std::cout << "✅ Fragment extracted to new island " << newIslandID 
-                                  << " (" << removedVoxels.size() << " voxels removed from original)" << std::endl;
+                                  << " (" << fragment.voxelCount << " voxels in " << fragment.chunkCoords.size()
+                                  << " chunks)" << std::endl;
                         
-                        auto server = m_networkManager->getServer();
-                        if (server)
+                        // One split message carries the break and the fragment's chunks to every client
+                        const FloatingIsland* newIsland = islandSystem->getIsland(newIslandID);
+                        if (server && newIsland)
                         {
-                            // Broadcast all removed voxels from the original island
-                            for (const Vec3& removedPos : removedVoxels)
-                            {
-                                server->broadcastVoxelChange(request.islandID, removedPos, 0, 0);
-                            }
+                            std::vector<Vec3> chunkCoords;
+                            chunkCoords.reserve(fragment.chunkCoords.size());
+                            for (const ChunkCoord& chunkCoord : fragment.chunkCoords)
+                                chunkCoords.push_back(chunkCoord.toVec3());
                             
-                            // Broadcast new island to all clients
-                            const FloatingIsland* newIsland = islandSystem->getIsland(newIslandID);
-                            if (newIsland)
-                            {
-                                std::cout << "📡 Broadcasting new island " << newIslandID 
-                                          << " (" << newIsland->chunks.size() << " chunks) to all clients" << std::endl;
-                                
-                                // Make a copy of connected clients to avoid iterator invalidation
-                                auto clients = server->getConnectedClients();
-                                
-                                // Send all chunks of the new island to all connected clients
-                                for (ENetPeer* clientPeer : clients)
-                                {
-                                    // Make a copy of chunk coordinates to avoid iterator invalidation
-                                    std::vector<Vec3> chunkCoords;
-                                    chunkCoords.reserve(newIsland->chunks.size());
-                                    for (const auto& [coord, _] : newIsland->chunks)
-                                    {
-                                        chunkCoords.push_back(coord);
-                                    }
-                                    
-                                    for (const Vec3& chunkCoord : chunkCoords)
-                                    {
-                                        auto it = newIsland->chunks.find(chunkCoord);
-                                        if (it != newIsland->chunks.end() && it->second)
-                                        {
-                                            const uint8_t* voxelData = it->second->getRawVoxelData();
-                                            uint32_t voxelDataSize = it->second->getVoxelDataSize();
-                                            
-                                            server->sendCompressedChunkToClient(
-                                                clientPeer, newIslandID, chunkCoord, 
-                                                newIsland->physicsCenter, voxelData, voxelDataSize);
-                                        }
-                                    }
-                                }
-                            }
+                            server->broadcastIslandSplit(request.islandID, request.localPos, newIslandID,
+                                                         newIsland->getPhysicsCenter(), newIsland->getRotation(),
+                                                         newIsland->velocity, newIsland->angularVelocity,
+                                                         fragment.chunkOffset.toVec3(), chunkCoords,
+                                                         fragment.voxels.data());
+                        }
+
+                        // A client that has the source island builds the whole fragment from the message -
+                        // streaming must not resend it. Clients without it drop the message; streaming
+                        // sends them the new island like any other.
+                        for (auto& [peer, stream] : m_clientStreams)
+                        {
+                            auto sourceIt = stream.sentChunks.find(request.islandID);
+                            if (sourceIt == stream.sentChunks.end() || sourceIt->second.empty())
+                                continue;
+                            ChunkCoordSet& sent = stream.sentChunks[newIslandID];
+                            for (const ChunkCoord& chunkCoord : fragment.chunkCoords)
+                                sent.insert(chunkCoord - fragment.chunkOffset);  // The new island's coords
                         }
                     }
-                    
-                    // Broadcast the original block change
-                    if (auto server = m_networkManager->getServer())
+                    else if (server)
                     {
+                        // Nothing moved - replicate the break alone
                         server->broadcastVoxelChange(request.islandID, request.localPos, request.voxelType, 0);
                     }
                     
@@ -587,10 +688,10 @@ void GameServer::broadcastIslandStates()
             m_totalTicks);  // Use tick count as sequence (truncated to 32-bit for network)
         update.entityID = islandID;
         update.entityType = 1;  // 1 = Island (as defined in NetworkMessages.h)
-        update.position = island.physicsCenter;
+        update.position = island.getPhysicsCenter();
         update.velocity = island.velocity;
         update.acceleration = island.acceleration;
-        update.rotation = island.rotation;               // Send rotation state
+        update.rotation = island.getRotation();  // Send rotation state
         update.angularVelocity = island.angularVelocity; // Send angular velocity
         update.serverTimestamp = serverTimestamp;
         update.flags = 0;  // No special flags for islands
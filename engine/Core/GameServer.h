@@ -8,7 +8,9 @@
 #include "../Network/NetworkMessages.h"  // For WorldStateMessage
 #include <memory>
 #include <atomic>
+#include <string>
 #include <thread>
+#include <unordered_map>
 
 /**
  * GameServer runs the authoritative game simulation in a headless environment.
@@ -34,8 +36,20 @@ public:
      * @param targetTickRate - Server simulation frequency (default: 60 Hz)
      * @param enableNetworking - Whether to start network server (default: false)
      * @param networkPort - Port for network server (default: 7777)
+     * @param headless - Dedicated server: chunks keep voxels + collision only (no render data)
      */
-    bool initialize(float targetTickRate = 60.0f, bool enableNetworking = false, uint16_t networkPort = 7777);
+    bool initialize(float targetTickRate = 60.0f, bool enableNetworking = false, uint16_t networkPort = 7777,
+                    bool headless = false);
+    
+    /**
+     * Persist the world in this directory (call before initialize). An existing save is loaded
+     * instead of generating; regenerate = start a new world there anyway. Empty = no saves.
+     */
+    void setWorldDirectory(const std::string& directory, bool regenerate = false)
+    {
+        m_worldDirectory = directory;
+        m_regenerateWorld = regenerate;
+    }
     
     /**
      * Start the server simulation loop
@@ -123,6 +137,17 @@ private:
      */
     void broadcastIslandStates();
     
+    /**
+     * Move the world's working set to where the players are, then send every client
+     * the chunks near it that it doesn't have yet
+     */
+    void updateStreaming();
+    
+    /**
+     * Send a client the loaded chunks within render distance of its player it wasn't sent yet
+     */
+    void streamChunksToClient(ENetPeer* peer);
+    
     // Core systems
     std::unique_ptr<GameState> m_gameState;
     std::unique_ptr<TimeManager> m_timeManager;
@@ -131,6 +156,25 @@ private:
     // Networking
     bool m_networkingEnabled = false;
     
+    // Dedicated server - lean chunk profile
+    bool m_headless = false;
+    
+    // Persistence - autosave writes only chunks edited since the previous save
+    static constexpr float AUTOSAVE_INTERVAL = 60.0f;  // Seconds of simulated time
+    std::string m_worldDirectory;
+    bool m_regenerateWorld = false;
+    float m_timeSinceAutosave = 0.0f;
+    
+    // Interest management - where each client's player is and which chunks it already has
+    static constexpr float STREAMING_INTERVAL = 0.25f;  // Seconds of simulated time
+    static constexpr int UNLOAD_MARGIN = 2;             // Chunks past render distance before a client drops one
+    struct ClientStream {
+        Vec3 position;                                            // Last reported player position
+        std::unordered_map<uint32_t, ChunkCoordSet> sentChunks;   // Per island
+    };
+    std::unordered_map<ENetPeer*, ClientStream> m_clientStreams;
+    float m_timeSinceStreaming = 0.0f;
+    
     // Threading
     std::atomic<bool> m_running{false};
     std::unique_ptr<std::thread> m_serverThread;
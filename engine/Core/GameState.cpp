@@ -4,9 +4,9 @@
 #include <iostream>
 #include <cstdlib>
 #include <ctime>
-#include <future>
 #include <vector>
 
+#include "JobSystem.h"
 #include "../World/VoxelChunk.h"
 #include "../World/VoronoiIslandPlacer.h"
 #include "../Rendering/GlobalLightingManager.h"
@@ -21,7 +21,7 @@ GameState::~GameState()
     shutdown();
 }
 
-bool GameState::initialize(bool shouldCreateDefaultWorld)
+bool GameState::initialize(bool shouldCreateDefaultWorld, const std::string& worldDirectory, bool regenerateWorld)
 {
     if (m_initialized)
     {
@@ -31,9 +31,6 @@ bool GameState::initialize(bool shouldCreateDefaultWorld)
 
     std::cout << "🌍 Initializing GameState..." << std::endl;
 
-    // Set static island system pointer for inter-chunk culling
-    VoxelChunk::setIslandSystem(&m_islandSystem);
-    
     // Initialize physics system - Re-enabled with fixed BodyID handling
     m_physicsSystem = std::make_unique<PhysicsSystem>();
 
@@ -43,10 +40,30 @@ bool GameState::initialize(bool shouldCreateDefaultWorld)
     
     std::cout << "💡 Configured lighting: Simple face-orientation lighting at 10 FPS for performance" << std::endl;
 
+    if (!worldDirectory.empty())
+    {
+        m_worldSave = std::make_unique<WorldSave>(worldDirectory);
+        m_islandSystem.setStreamSource(m_worldSave.get());  // Evicted chunks go to the region files
+    }
+
+    // A saved world comes back as islands + mapped region files - nothing is generated or decoded
+    bool loadedWorld = false;
+    if (m_worldSave && m_worldSave->exists() && !regenerateWorld)
+    {
+        loadedWorld = loadWorld();
+        if (!loadedWorld)
+        {
+            std::cerr << "⚠️  Could not load the saved world - generating a new one" << std::endl;
+        }
+    }
+
     // Create default world if requested
-    if (shouldCreateDefaultWorld)
+    if (!loadedWorld && shouldCreateDefaultWorld)
     {
         createDefaultWorld();
+        
+        // First save right away - the next start loads instead of regenerating
+        saveWorld();
     }
 
     m_initialized = true;
@@ -62,6 +79,8 @@ void GameState::shutdown()
 
     std::cout << "🔄 Shutting down GameState..." << std::endl;
 
+    saveWorld();
+
     // Clear island data
     m_islandIDs.clear();
 
@@ -99,6 +118,14 @@ void GameState::setPrimaryPlayerPosition(const Vec3& position)
 
 bool GameState::setVoxel(uint32_t islandID, const Vec3& localPos, uint8_t voxelType)
 {
+    // An edit to an evicted chunk must land on its stored voxels, not on a fresh empty chunk
+    if (m_worldSave)
+    {
+        const ChunkCoord chunkCoord = FloatingIsland::islandPosToChunkCoord(localPos);
+        if (m_worldSave->isChunkStored(islandID, chunkCoord))
+            m_worldSave->pageInChunks(m_islandSystem, islandID, {chunkCoord});
+    }
+    
     // Delegate to island system
     m_islandSystem.setVoxelInIsland(islandID, localPos, voxelType);
     return true;  // Error handling will be added when async operations are implemented
@@ -115,6 +142,34 @@ Vec3 GameState::getIslandCenter(uint32_t islandID) const
     return m_islandSystem.getIslandCenter(islandID);
 }
 
+bool GameState::saveWorld()
+{
+    if (!m_worldSave)
+    {
+        return true;
+    }
+    return m_worldSave->save(m_islandSystem, m_playerSpawnPosition);
+}
+
+void GameState::updateStreaming(const std::vector<Vec3>& playerPositions)
+{
+    m_islandSystem.updatePlayerChunks(playerPositions);
+}
+
+bool GameState::loadWorld()
+{
+    std::vector<uint32_t> islandIDs;
+    if (!m_worldSave->load(m_islandSystem, islandIDs, m_playerSpawnPosition))
+    {
+        return false;
+    }
+
+    m_islandIDs = islandIDs;
+    std::cout << "🎯 Player spawn: (" << m_playerSpawnPosition.x << ", " 
+              << m_playerSpawnPosition.y << ", " << m_playerSpawnPosition.z << ")" << std::endl;
+    return true;
+}
+
 void GameState::createDefaultWorld()
 {
     std::cout << "🏝️ Creating procedural world with Voronoi island placement..." << std::endl;
@@ -170,12 +225,13 @@ void GameState::createDefaultWorld()
     
     std::cout << "[WORLD] Voronoi placement generated " << islandDefs.size() << " islands" << std::endl;
     
-    // Create islands from definitions
+    // Create islands from definitions - generation is deferred until a player comes near
     std::vector<uint32_t> islandIDs;
     islandIDs.reserve(islandDefs.size());
     
     for (const auto& def : islandDefs) {
         uint32_t islandID = m_islandSystem.createIsland(def.position);
+        m_islandSystem.deferIslandGeneration(islandID, def.seed, def.radius);
         islandIDs.push_back(islandID);
         m_islandIDs.push_back(islandID);
         
@@ -184,39 +240,36 @@ void GameState::createDefaultWorld()
                   << " radius=" << def.radius << std::endl;
     }
     
-    // **PARALLEL ISLAND GENERATION** using std::async
-    std::cout << "[WORLD] Generating islands in parallel..." << std::endl;
-    
-    std::vector<std::future<void>> generationFutures;
-    generationFutures.reserve(islandDefs.size());
+    // Calculate player spawn position above the first island
+    m_playerSpawnPosition = Vec3(0.0f, 64.0f, 0.0f);  // Default fallback
     
-    // Launch all island generations asynchronously
-    for (size_t i = 0; i < islandDefs.size(); ++i) {
-        const IslandDefinition& def = islandDefs[i];
-        uint32_t islandID = islandIDs[i];
-        
-        generationFutures.push_back(std::async(std::launch::async, 
-            [this, islandID, def]() {
-                std::cout << "[WORLD] Generating island " << islandID 
-                          << " (radius=" << def.radius << ")..." << std::endl;
-                m_islandSystem.generateFloatingIslandOrganic(islandID, def.seed, def.radius);
-            }
-        ));
+    if (!islandDefs.empty()) {
+        // Spawn above the first island
+        Vec3 firstIslandCenter = islandDefs[0].position;
+        m_playerSpawnPosition = Vec3(firstIslandCenter.x, firstIslandCenter.y + 64.0f, firstIslandCenter.z);
     }
     
-    // Wait for all islands to finish generating
-    for (auto& future : generationFutures)
-    {
-        future.get();
-    }
+    // **SPAWN AREA** is generated up front (in parallel on the job system) so the first player
+    // lands on solid ground; every other island waits for the streaming update that reaches it
+    std::cout << "[WORLD] Generating islands around the spawn..." << std::endl;
+    
+    const JobSystem::Statistics jobsBefore = g_jobSystem.getStatistics();
+    m_islandSystem.generateChunksAroundPoint(m_playerSpawnPosition);
+    const size_t generatedIslands = m_islandSystem.attachGeneratedIslands(true);
+    m_islandSystem.updatePlayerChunks(m_playerSpawnPosition);  // Wakes the spawn's working set
+    const JobSystem::Statistics jobsAfter = g_jobSystem.getStatistics();
+    std::cout << "[WORLD] " << (jobsAfter.executed - jobsBefore.executed) << " jobs on "
+              << g_jobSystem.getThreadCount() << " threads (" << (jobsAfter.stolen - jobsBefore.stolen)
+              << " stolen)" << std::endl;
     
-    std::cout << "[WORLD] All islands generated!" << std::endl;
+    std::cout << "[WORLD] " << generatedIslands << " of " << islandIDs.size() << " islands generated ("
+              << (islandIDs.size() - generatedIslands) << " deferred until a player approaches)" << std::endl;
 
     // Log collision mesh generation for each island
     for (uint32_t islandID : m_islandIDs)
     {
         const FloatingIsland* island = m_islandSystem.getIsland(islandID);
-        if (island)
+        if (island && m_islandSystem.isIslandGenerated(islandID))
         {
             // Count solid voxels across all chunks in this island
             int solidVoxels = 0;
@@ -255,15 +308,6 @@ void GameState::createDefaultWorld()
         }
     }
     
-    // Calculate player spawn position above the first island
-    m_playerSpawnPosition = Vec3(0.0f, 64.0f, 0.0f);  // Default fallback
-    
-    if (!islandDefs.empty()) {
-        // Spawn above the first island
-        Vec3 firstIslandCenter = islandDefs[0].position;
-        m_playerSpawnPosition = Vec3(firstIslandCenter.x, firstIslandCenter.y + 64.0f, firstIslandCenter.z);
-    }
-
     std::cout << "🎯 Player spawn: (" << m_playerSpawnPosition.x << ", " 
               << m_playerSpawnPosition.y << ", " << m_playerSpawnPosition.z << ")" << std::endl;
 }
@@ -5,7 +5,9 @@
 #include "../Math/Vec3.h"
 #include "../World/IslandChunkSystem.h"
 #include "../Physics/PhysicsSystem.h"  // Re-enabled with fixed BodyID handling
+#include "../World/WorldSave.h"
 #include <memory>
+#include <string>
 #include <vector>
 
 /**
@@ -31,14 +33,34 @@ public:
     /**
      * Initialize the game state with default world
      * @param shouldCreateDefaultWorld - Whether to create the standard 3-island world
+     * @param worldDirectory - Save directory; an existing save is loaded instead of generating (empty = no saves)
+     * @param regenerateWorld - Generate a new world even if the directory already holds one
      */
-    bool initialize(bool shouldCreateDefaultWorld = true);
+    bool initialize(bool shouldCreateDefaultWorld = true, const std::string& worldDirectory = "",
+                    bool regenerateWorld = false);
     
     /**
-     * Shutdown and cleanup all systems
+     * Shutdown and cleanup all systems (saves the world first when it has a save directory)
      */
     void shutdown();
     
+    // ================================
+    // PERSISTENCE
+    // ================================
+    
+    /**
+     * Write everything changed since the last save (no-op without a save directory)
+     */
+    bool saveWorld();
+    
+    WorldSave* getWorldSave() { return m_worldSave.get(); }
+    
+    /**
+     * Interest-based streaming: generate, page in and evict chunks around these players
+     * (eviction only happens with a save directory - evicted chunks live on disk)
+     */
+    void updateStreaming(const std::vector<Vec3>& playerPositions);
+    
     // ================================
     // SIMULATION UPDATE
     // ================================
@@ -111,6 +133,7 @@ private:
     // Core systems
     IslandChunkSystem m_islandSystem;
     std::unique_ptr<PhysicsSystem> m_physicsSystem;  // Re-enabled with fixed BodyID handling
+    std::unique_ptr<WorldSave> m_worldSave;          // Null when the world isn't persisted
     
     // World state
     std::vector<uint32_t> m_islandIDs;  // Track all created islands
@@ -124,10 +147,15 @@ private:
     // ================================
     
     /**
-     * Create the default 3-island world for testing
+     * Lay out the procedural world - islands near the spawn are generated, the rest when a player approaches
      */
     void createDefaultWorld();
     
+    /**
+     * Recreate the islands of a saved world (chunks are paged in later, on demand)
+     */
+    bool loadWorld();
+    
     /**
      * Update physics systems
      */
@@ -0,0 +1,281 @@
+// JobSystem.cpp - Work-stealing job scheduler implementation
+#include "JobSystem.h"
+
+#include <iostream>
+
+JobSystem g_jobSystem;
+
+namespace
+{
+// Which pool (if any) the current thread works for, and its deque there
+thread_local const JobSystem* t_ownerPool = nullptr;
+thread_local unsigned t_workerIndex = 0;
+}  // namespace
+
+JobSystem::~JobSystem()
+{
+    shutdown();
+}
+
+bool JobSystem::initialize(unsigned workerCount)
+{
+    std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+    if (m_started.load(std::memory_order_acquire))
+    {
+        std::cerr << "⚠️  JobSystem already initialized" << std::endl;
+        return false;
+    }
+    startLocked(workerCount);
+    return true;
+}
+
+void JobSystem::startLocked(unsigned workerCount)
+{
+    if (workerCount == 0)
+    {
+        // Whoever waits on a job runs jobs too - one worker fewer than hardware threads
+        workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+    }
+
+    m_stopping = false;
+    m_queues.clear();
+    for (unsigned i = 0; i <= workerCount; ++i)
+        m_queues.push_back(std::make_unique<WorkQueue>());
+
+    for (unsigned i = 0; i < workerCount; ++i)
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+
+    m_started.store(true, std::memory_order_release);
+    std::cout << "🧵 Job system: " << workerCount << " worker thread(s)" << std::endl;
+}
+
+void JobSystem::ensureStarted()
+{
+    if (m_started.load(std::memory_order_acquire))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+    if (!m_started.load(std::memory_order_acquire))
+        startLocked(0);
+}
+
+void JobSystem::shutdown()
+{
+    std::lock_guard<std::mutex> lock(m_lifecycleMutex);
+    if (!m_started.load(std::memory_order_acquire))
+        return;
+
+    {
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    m_workers.clear();
+    m_queues.clear();
+    m_queued.store(0);
+    m_started.store(false, std::memory_order_release);
+}
+
+JobSystem::JobHandle JobSystem::createJob(std::function<void()> fn, JobPriority priority, const JobHandle& parent)
+{
+    auto job = std::make_shared<Job>();
+    job->fn = std::move(fn);
+    job->priority = priority;
+    if (parent)
+    {
+        parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+        job->parent = parent;
+    }
+    return job;
+}
+
+void JobSystem::run(const JobHandle& job)
+{
+    if (!job)
+        return;
+    ensureStarted();
+    push(job);
+}
+
+void JobSystem::wait(const JobHandle& job)
+{
+    if (!job)
+        return;
+
+    m_waiters.fetch_add(1);
+    while (!isFinished(job))
+    {
+        // Help with our own tree only - the rest of it is running elsewhere if nothing is queued
+        const uint64_t progress = m_progress.load();
+        if (runOne(job.get()))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_waitProgress.wait(lock, [&] { return isFinished(job) || m_progress.load() != progress; });
+    }
+    m_waiters.fetch_sub(1);
+}
+
+unsigned JobSystem::getThreadCount()
+{
+    ensureStarted();
+    return static_cast<unsigned>(m_workers.size()) + 1;
+}
+
+JobSystem::Statistics JobSystem::getStatistics() const
+{
+    Statistics stats;
+    stats.executed = m_executed.load(std::memory_order_relaxed);
+    stats.stolen = m_stolen.load(std::memory_order_relaxed);
+    stats.queued = m_queued.load(std::memory_order_relaxed);
+    stats.workers = m_workers.size();
+    return stats;
+}
+
+void JobSystem::push(const JobHandle& job)
+{
+    // Workers keep their own spawns local; everyone else goes through the injection queue
+    const unsigned queueIndex = (t_ownerPool == this) ? t_workerIndex : static_cast<unsigned>(m_queues.size() - 1);
+    WorkQueue& queue = *m_queues[queueIndex];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs[static_cast<size_t>(job->priority)].push_back(job);
+        m_queued.fetch_add(1, std::memory_order_release);
+    }
+    m_progress.fetch_add(1);
+
+    // Empty critical section orders the count bump against a worker's predicate check
+    {
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+    }
+    m_workAvailable.notify_one();
+    if (m_waiters.load() > 0)
+        m_waitProgress.notify_all();
+}
+
+void JobSystem::notifyWaiters()
+{
+    m_progress.fetch_add(1);
+    if (m_waiters.load() == 0)
+        return;
+
+    {
+        std::lock_guard<std::mutex> sleepLock(m_sleepMutex);
+    }
+    m_waitProgress.notify_all();
+}
+
+JobSystem::JobHandle JobSystem::pop(unsigned ownQueue, const Job* root)
+{
+    if (m_queued.load(std::memory_order_acquire) == 0)
+        return nullptr;
+
+    // Queued jobs and their ancestors are unfinished, so the parent chain is stable to walk
+    auto qualifies = [root](const JobHandle& job)
+    {
+        if (!root)
+            return true;
+        for (const Job* node = job.get(); node; node = node->parent.get())
+        {
+            if (node == root)
+                return true;
+        }
+        return false;
+    };
+
+    const size_t queueCount = m_queues.size();
+    for (size_t priority = 0; priority < static_cast<size_t>(JobPriority::COUNT); ++priority)
+    {
+        {
+            WorkQueue& own = *m_queues[ownQueue];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            auto& jobs = own.jobs[priority];
+            for (auto it = jobs.rbegin(); it != jobs.rend(); ++it)
+            {
+                if (!qualifies(*it))
+                    continue;
+                JobHandle job = std::move(*it);
+                jobs.erase(std::next(it).base());
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+
+        // Steal the oldest job of this priority, scanning from the next deque round
+        for (size_t offset = 1; offset < queueCount; ++offset)
+        {
+            WorkQueue& victim = *m_queues[(ownQueue + offset) % queueCount];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            auto& jobs = victim.jobs[priority];
+            for (auto it = jobs.begin(); it != jobs.end(); ++it)
+            {
+                if (!qualifies(*it))
+                    continue;
+                JobHandle job = std::move(*it);
+                jobs.erase(it);
+                m_queued.fetch_sub(1, std::memory_order_relaxed);
+                m_stolen.fetch_add(1, std::memory_order_relaxed);
+                return job;
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::runOne(const Job* root)
+{
+    if (!m_started.load(std::memory_order_acquire))
+        return false;
+
+    const unsigned ownQueue = (t_ownerPool == this) ? t_workerIndex : static_cast<unsigned>(m_queues.size() - 1);
+    JobHandle job = pop(ownQueue, root);
+    if (!job)
+        return false;
+
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(const JobHandle& job)
+{
+    if (job->fn)
+        job->fn();
+    m_executed.fetch_add(1, std::memory_order_relaxed);
+    finish(job);
+}
+
+void JobSystem::finish(const JobHandle& job)
+{
+    if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return;  // Children still running - the last one finishes us
+
+    // Release captures (and the parent link) as soon as the tree no longer needs them
+    job->fn = nullptr;
+    JobHandle parent = std::move(job->parent);
+    notifyWaiters();
+    if (parent)
+        finish(parent);
+}
+
+void JobSystem::workerLoop(unsigned workerIndex)
+{
+    t_ownerPool = this;
+    t_workerIndex = workerIndex;
+
+    while (true)
+    {
+        if (runOne())
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        m_workAvailable.wait(lock, [this] { return m_stopping || m_queued.load(std::memory_order_acquire) > 0; });
+        if (m_stopping)
+            return;
+    }
+}
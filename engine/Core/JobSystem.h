@@ -0,0 +1,153 @@
+// JobSystem.h - Engine-wide work-stealing job scheduler
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class JobPriority : uint8_t
+{
+    High = 0,    // Latency-bound work someone is waiting on (parallelFor ranges)
+    Normal = 1,
+    Low = 2,     // Background work that can wait behind everything else
+    COUNT = 3
+};
+
+// Fixed worker pool with one deque per thread (per priority). Owners push and pop at the back
+// (LIFO, cache-warm); idle workers steal from the front of other deques (FIFO, oldest = largest
+// work first). Jobs submitted from outside the pool land in a shared injection deque.
+//
+// Parent/child: a job created with a parent keeps that parent unfinished until it finishes too,
+// so waiting on the parent waits on the whole tree. Children must be created before the parent
+// finishes (from its own body, or before it is run).
+//
+// wait() runs the queued jobs of the awaited tree itself and parks only once none are left, so
+// jobs may wait on jobs (nested parallelFor) without deadlocking the pool or adding threads. It
+// never picks up unrelated work - a waiter can't get stuck behind someone else's long job, and
+// nesting stays bounded by the depth of the tree.
+class JobSystem
+{
+   public:
+    struct Job
+    {
+        std::function<void()> fn;                 // May be empty (pure grouping job)
+        std::shared_ptr<Job> parent;
+        std::atomic<int> unfinished{1};           // Own body + unfinished children
+        JobPriority priority = JobPriority::Normal;
+    };
+    using JobHandle = std::shared_ptr<Job>;
+
+    JobSystem() = default;
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Started lazily by the first run(); call explicitly to pick the worker count
+    bool initialize(unsigned workerCount = 0);  // 0 = hardware threads - 1 (the waiting caller is the last)
+    void shutdown();
+
+    JobHandle createJob(std::function<void()> fn, JobPriority priority = JobPriority::Normal,
+                        const JobHandle& parent = nullptr);
+    void run(const JobHandle& job);
+    JobHandle submit(std::function<void()> fn, JobPriority priority = JobPriority::Normal)
+    {
+        JobHandle job = createJob(std::move(fn), priority);
+        run(job);
+        return job;
+    }
+
+    // Blocks until the job and all its children finished, running its queued children meanwhile
+    void wait(const JobHandle& job);
+    static bool isFinished(const JobHandle& job) { return !job || job->unfinished.load(std::memory_order_acquire) == 0; }
+
+    // fn(index) for every index in [0, count), split into grainSize ranges (0 = ~4 per thread),
+    // one child job each. Returns when all ran; the caller works through ranges as well.
+    template <typename Fn>
+    void parallelFor(size_t count, Fn&& fn, size_t grainSize = 0, JobPriority priority = JobPriority::High);
+
+    // Workers plus the thread that waits
+    unsigned getThreadCount();
+
+    struct Statistics
+    {
+        uint64_t executed = 0;
+        uint64_t stolen = 0;  // Run by a thread other than the one whose deque held it
+        size_t queued = 0;
+        size_t workers = 0;
+    };
+    Statistics getStatistics() const;
+
+   private:
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<JobHandle> jobs[static_cast<size_t>(JobPriority::COUNT)];
+    };
+
+    void ensureStarted();
+    void startLocked(unsigned workerCount);  // m_lifecycleMutex held
+    void workerLoop(unsigned workerIndex);
+    void push(const JobHandle& job);
+    // Own back first, then steal fronts - by priority. With a root, only jobs of that tree qualify.
+    JobHandle pop(unsigned ownQueue, const Job* root = nullptr);
+    bool runOne(const Job* root = nullptr);  // Executes one queued job (of the root's tree) if any
+    void execute(const JobHandle& job);
+    void finish(const JobHandle& job);
+    void notifyWaiters();  // Something was queued or finished - parked wait() calls re-check
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;  // One per worker, the last is the injection queue
+    std::vector<std::thread> m_workers;
+    std::mutex m_lifecycleMutex;
+    std::atomic<bool> m_started{false};
+    bool m_stopping = false;
+
+    std::mutex m_sleepMutex;
+    std::condition_variable m_workAvailable;
+    std::atomic<size_t> m_queued{0};
+    std::condition_variable m_waitProgress;  // Parked wait() calls, on m_sleepMutex
+    std::atomic<uint64_t> m_progress{0};     // Bumped on every push and finished job
+    std::atomic<int> m_waiters{0};
+
+    std::atomic<uint64_t> m_executed{0};
+    std::atomic<uint64_t> m_stolen{0};
+};
+
+template <typename Fn>
+void JobSystem::parallelFor(size_t count, Fn&& fn, size_t grainSize, JobPriority priority)
+{
+    if (count == 0)
+        return;
+    if (grainSize == 0)
+        grainSize = std::max<size_t>(1, count / (static_cast<size_t>(getThreadCount()) * 4));
+    if (count <= grainSize)
+    {
+        for (size_t index = 0; index < count; ++index)
+            fn(index);
+        return;
+    }
+
+    // Empty root so the ranges can be queued before anything waits on them
+    JobHandle root = createJob(nullptr, priority);
+    for (size_t begin = 0; begin < count; begin += grainSize)
+    {
+        const size_t end = std::min(count, begin + grainSize);
+        run(createJob([&fn, begin, end]() {
+            for (size_t index = begin; index < end; ++index)
+                fn(index);
+        }, priority, root));
+    }
+    run(root);
+    wait(root);
+}
+
+// Global scheduler (worldgen, server and client alike)
+extern JobSystem g_jobSystem;
@@ -2,12 +2,15 @@
 #include "PlayerController.h"
 
 #include <GLFW/glfw3.h>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
 #include "../World/IslandChunkSystem.h"
 #include "../Profiling/Profiler.h"
 
+PlayerController::CollisionResolveMode PlayerController::s_resolveMode = PlayerController::CollisionResolveMode::Contacts;
+
 PlayerController::PlayerController()
 {
     // Initialize camera with default values
@@ -129,7 +132,6 @@ void PlayerController::updateNoclip(GLFWwindow* window, float deltaTime)
 void PlayerController::updatePhysics(GLFWwindow* window, float deltaTime, IslandChunkSystem* islandSystem)
 {
     PROFILE_FUNCTION();
-    (void)islandSystem; // Reserved for future island-specific physics interactions
     
     // ==========================================
     // PHASE 0: UPDATE STEP-UP ANIMATION
@@ -180,10 +182,16 @@ void PlayerController::updatePhysics(GLFWwindow* window, float deltaTime, Island
     // PHASE 2: DETECT GROUND STATE
     // ==========================================
     
-    const float raycastMargin = 0.1f;
-    GroundInfo groundInfo = g_physics.detectGroundCapsule(m_physicsPosition, m_capsuleRadius,
-                                                          m_capsuleHeight, raycastMargin);
-    m_isGrounded = groundInfo.isGrounded;
+    // Contact resolution senses the ground in the query that moves the player (last frame's result
+    // stands); the probe path casts a ray for it
+    if (s_resolveMode == CollisionResolveMode::Probes)
+    {
+        const float raycastMargin = 0.1f;
+        GroundInfo groundInfo = g_physics.detectGroundCapsule(m_physicsPosition, m_capsuleRadius,
+                                                              m_capsuleHeight, raycastMargin);
+        m_isGrounded = groundInfo.isGrounded;
+        m_groundIslandID = groundInfo.standingOnIslandID;
+    }
     
     // ==========================================
     // PHASE 3: APPLY PHYSICS
@@ -219,10 +227,7 @@ void PlayerController::updatePhysics(GLFWwindow* window, float deltaTime, Island
         // Check for climbing - if holding space in air and moving into a wall
         if (jumpThisFrame && inputDirection.lengthSquared() > 0.01f)
         {
-            // Try moving forward slightly to detect wall collision
-            Vec3 forwardTest = m_physicsPosition + (inputDirection.normalized() * 0.3f);
-            Vec3 climbNormal;
-            if (g_physics.checkCapsuleCollision(forwardTest, m_capsuleRadius, m_capsuleHeight, climbNormal, nullptr))
+            if (isWallAhead(inputDirection.normalized()))
             {
                 // Wall detected! Check if we can climb over it (max 3 blocks)
                 // Check 1 block forward and 1 block above player's top
@@ -256,13 +261,39 @@ void PlayerController::updatePhysics(GLFWwindow* window, float deltaTime, Island
     m_playerVelocity.x += velocityDelta.x;
     m_playerVelocity.z += velocityDelta.z;
     
+    // ==========================================
+    // PHASE 4: COLLISION DETECTION
+    // ==========================================
+    
     // Calculate intended movement
     Vec3 intendedMovement = m_playerVelocity * deltaTime;
     
+    if (s_resolveMode == CollisionResolveMode::Probes)
+        moveWithProbes(intendedMovement, deltaTime, islandSystem);
+    else
+        moveWithContacts(intendedMovement, deltaTime, islandSystem);
+    
     // ==========================================
-    // PHASE 4: COLLISION DETECTION
+    // PHASE 5: UPDATE PILOTING STATE
     // ==========================================
     
+    if (m_isGrounded)
+    {
+        m_pilotedIslandID = m_groundIslandID;
+    }
+    else
+    {
+        if (!m_isPiloting)
+        {
+            m_pilotedIslandID = 0;
+        }
+    }
+    
+    PROFILE_COUNTER("Capsule queries/frame", g_physics.takeCapsuleQueryCount());
+}
+
+void PlayerController::moveWithProbes(const Vec3& intendedMovement, float deltaTime, IslandChunkSystem* islandSystem)
+{
     Vec3 intendedPosition = m_physicsPosition + intendedMovement;
     
     Vec3 collisionNormal;
@@ -386,55 +417,149 @@ void PlayerController::updatePhysics(GLFWwindow* window, float deltaTime, Island
         m_physicsPosition = intendedPosition;
         
         // If grounded, move with the island (raycast-based riding)
-        if (m_isGrounded && groundInfo.standingOnIslandID != 0)
+        if (m_isGrounded && m_groundIslandID != 0)
+            rideIsland(islandSystem, m_groundIslandID, deltaTime);
+    }
+}
+
+void PlayerController::moveWithContacts(const Vec3& intendedMovement, float deltaTime, IslandChunkSystem* islandSystem)
+{
+    // Carried by the island stood on (linear + spin) before moving on our own
+    if (m_isGrounded && m_groundIslandID != 0)
+        rideIsland(islandSystem, m_groundIslandID, deltaTime);
+    
+    // Substeps of at most half the radius, so a fast frame can't tunnel through a voxel
+    const float maxSubstep = m_capsuleRadius * 0.5f;
+    const int substeps = std::clamp(static_cast<int>(std::ceil(intendedMovement.length() / maxSubstep)), 1, MAX_SUBSTEPS);
+    const Vec3 substep = intendedMovement / static_cast<float>(substeps);
+    const bool canStep = m_isGrounded && !m_isStepping;
+    
+    for (int i = 0; i < substeps; ++i)
+    {
+        m_physicsPosition += substep;
+        
+        // One query per substep: penetrations plus whatever lies within the skin (ground, walls)
+        m_contacts.clear();
+        g_physics.queryCapsuleContacts(m_physicsPosition, m_capsuleRadius, m_capsuleHeight, m_contacts, m_contactSkin);
+        
+        m_isGrounded = false;
+        m_groundIslandID = 0;
+        m_wallNormal = Vec3(0, 0, 0);
+        const CapsuleContact* blockingWall = nullptr;
+        
+        // Deepest first: each contact pushes out only what earlier corrections left uncovered
+        Vec3 correction(0, 0, 0);
+        for (const CapsuleContact& contact : m_contacts)
         {
-            FloatingIsland* island = islandSystem->getIsland(groundInfo.standingOnIslandID);
-            if (island)
+            if (contact.normal.y > 0.7f)
             {
-                // Apply linear velocity
-                m_physicsPosition = m_physicsPosition + (groundInfo.groundVelocity * deltaTime);
-                
-                // Apply angular velocity (rotation around island center)
-                if (island->angularVelocity.lengthSquared() > 0.0001f)
-                {
-                    // Get player's offset from island center
-                    Vec3 offset = m_physicsPosition - island->physicsCenter;
-                    
-                    // Rotate offset around Y axis
-                    float angleChange = island->angularVelocity.y * deltaTime;
-                    float cosAngle = std::cos(angleChange);
-                    float sinAngle = std::sin(angleChange);
-                    
-                    Vec3 rotatedOffset;
-                    rotatedOffset.x = offset.x * cosAngle + offset.z * sinAngle;
-                    rotatedOffset.y = offset.y;
-                    rotatedOffset.z = -offset.x * sinAngle + offset.z * cosAngle;
-                    
-                    // Update position
-                    m_physicsPosition = island->physicsCenter + rotatedOffset;
-                    
-                    // Rotate camera yaw to match island rotation (negative because camera is inverted)
-                    m_camera.yaw -= angleChange * (180.0f / 3.14159265f);
-                    m_camera.updateCameraVectors();
-                }
+                if (!m_isGrounded)
+                    m_groundIslandID = contact.island->islandID;
+                m_isGrounded = true;
             }
+            else if (std::abs(contact.normal.y) < 0.3f && m_wallNormal.lengthSquared() == 0.0f)
+            {
+                m_wallNormal = contact.normal;
+                if (contact.depth > 0.0f)
+                    blockingWall = &contact;
+            }
+            
+            if (contact.depth <= 0.0f)
+                continue;
+            const float covered = correction.dot(contact.normal);
+            if (contact.depth > covered)
+                correction += contact.normal * (contact.depth - covered);
+            
+            // Velocity into the surface is spent (ground ends the fall, a wall the run)
+            const float into = m_playerVelocity.dot(contact.normal);
+            if (into < 0.0f)
+                m_playerVelocity -= contact.normal * into;
         }
+        
+        // Walked into a ledge from the ground - climb it if the capsule fits on top, keeping the
+        // horizontal progress (the step animation lifts the player clear over the next frames)
+        if (blockingWall && canStep && tryStepUp())
+            return;
+        
+        m_physicsPosition += correction;
     }
+}
+
+bool PlayerController::tryStepUp()
+{
+    // Raised by the max step: free of walls, and standing on something within reach below?
+    const Vec3 raised = m_physicsPosition + Vec3(0, m_maxStepHeight, 0);
+    m_stepContacts.clear();
+    g_physics.queryCapsuleContacts(raised, m_capsuleRadius, m_capsuleHeight, m_stepContacts, m_maxStepHeight + m_contactSkin);
     
-    // ==========================================
-    // PHASE 5: UPDATE PILOTING STATE
-    // ==========================================
-    
-    if (m_isGrounded)
-    {
-        m_pilotedIslandID = groundInfo.standingOnIslandID;
-    }
-    else
+    float stepHeight = -1.0f;
+    for (const CapsuleContact& contact : m_stepContacts)
     {
-        if (!m_isPiloting)
+        if (contact.normal.y < 0.3f)
         {
-            m_pilotedIslandID = 0;
+            if (contact.depth > 0.0f)
+                return false;  // Wall or ceiling still in the way up there
+            continue;
         }
+        // Deepest upward contact = top of the ledge (its edge may still graze the capsule's rim);
+        // a gap below it is how far the raise overshot
+        if (stepHeight < 0.0f)
+            stepHeight = m_maxStepHeight + std::min(0.0f, contact.depth);
+    }
+    if (stepHeight <= 0.0f)
+        return false;
+    
+    // Initialize step-up animation
+    m_isStepping = true;
+    m_stepProgress = 0.0f;
+    m_stepStartHeight = m_physicsPosition.y;
+    m_stepTargetHeight = m_physicsPosition.y + stepHeight;
+    return true;
+}
+
+bool PlayerController::isWallAhead(const Vec3& direction)
+{
+    // Contact resolution already knows the wall it touched last frame
+    if (s_resolveMode == CollisionResolveMode::Contacts)
+        return m_wallNormal.dot(direction) < -0.5f;
+    
+    // Try moving forward slightly to detect wall collision
+    Vec3 forwardTest = m_physicsPosition + (direction * 0.3f);
+    Vec3 climbNormal;
+    return g_physics.checkCapsuleCollision(forwardTest, m_capsuleRadius, m_capsuleHeight, climbNormal, nullptr);
+}
+
+void PlayerController::rideIsland(IslandChunkSystem* islandSystem, uint32_t islandID, float deltaTime)
+{
+    FloatingIsland* island = islandSystem ? islandSystem->getIsland(islandID) : nullptr;
+    if (!island)
+        return;
+    
+    // Apply linear velocity
+    m_physicsPosition = m_physicsPosition + (island->velocity * deltaTime);
+    
+    // Apply angular velocity (rotation around island center)
+    if (island->angularVelocity.lengthSquared() > 0.0001f)
+    {
+        // Get player's offset from island center
+        Vec3 offset = m_physicsPosition - island->getPhysicsCenter();
+        
+        // Rotate offset around Y axis
+        float angleChange = island->angularVelocity.y * deltaTime;
+        float cosAngle = std::cos(angleChange);
+        float sinAngle = std::sin(angleChange);
+        
+        Vec3 rotatedOffset;
+        rotatedOffset.x = offset.x * cosAngle + offset.z * sinAngle;
+        rotatedOffset.y = offset.y;
+        rotatedOffset.z = -offset.x * sinAngle + offset.z * cosAngle;
+        
+        // Update position
+        m_physicsPosition = island->getPhysicsCenter() + rotatedOffset;
+        
+        // Rotate camera yaw to match island rotation (negative because camera is inverted)
+        m_camera.yaw -= angleChange * (180.0f / 3.14159265f);
+        m_camera.updateCameraVectors();
     }
 }
 
@@ -6,6 +6,9 @@
 #include "../Math/Vec3.h"
 #include "../Physics/PhysicsSystem.h"
 
+#include <cstdint>
+#include <vector>
+
 // Forward declarations
 struct GLFWwindow;
 class IslandChunkSystem;
@@ -90,6 +93,19 @@ public:
     // Check if UI is blocking input (e.g., periodic table open)
     void setUIBlocking(bool blocking) { m_uiBlocking = blocking; }
 
+    // How movement is resolved against the world (shared by all controllers):
+    // Contacts - one contact-set query per substep depenetrates the capsule and senses ground and walls
+    // Probes   - the original boolean probes (ground ray, axis-separated retries, step-up search),
+    //            kept for A/B comparison (--collision-probes)
+    // The "Capsule queries/frame" profiler counter shows what each costs.
+    enum class CollisionResolveMode : uint8_t
+    {
+        Contacts,
+        Probes
+    };
+    static void setCollisionResolveMode(CollisionResolveMode mode) { s_resolveMode = mode; }
+    static CollisionResolveMode getCollisionResolveMode() { return s_resolveMode; }
+
 private:
     // ================================
     // INTERNAL STATE
@@ -103,6 +119,10 @@ private:
     Vec3 m_physicsPosition{0.0f, 0.0f, 0.0f};       // Actual hitbox position (can jitter)
     bool m_isGrounded = false;
     bool m_jumpPressed = false;
+    uint32_t m_groundIslandID = 0;                  // Island stood on (0 = none)
+    Vec3 m_wallNormal{0.0f, 0.0f, 0.0f};            // Wall touched by the last contact query (zero = none)
+    std::vector<CapsuleContact> m_contacts;         // Contact query scratch
+    std::vector<CapsuleContact> m_stepContacts;     // Step-up query scratch (m_contacts is still in use)
     
     // Step-up state
     bool m_isStepping = false;          // Currently performing a step-up animation
@@ -127,6 +147,10 @@ private:
     float m_maxStepHeight = 1.1f;       // Maximum height the player can step up (1 block + margin)
     float m_stepDuration = 0.5f;        // Time to complete a step-up animation (seconds)
     float m_stepSlowdown = 0.5f;        // Speed multiplier during step-up (50% speed)
+    float m_contactSkin = 0.1f;         // Contacts this close count as touching (ground/wall sensing)
+    static constexpr int MAX_SUBSTEPS = 8;  // Contact resolution substeps per frame, at most
+    
+    static CollisionResolveMode s_resolveMode;
     
     // Debug modes
     bool m_noclipMode = false;          // Debug: disable physics
@@ -153,6 +177,28 @@ private:
      */
     void updatePhysics(GLFWwindow* window, float deltaTime, IslandChunkSystem* islandSystem);
     
+    /**
+     * Move by this frame's movement: original probes (axis-separated retries, step-up search)
+     * or one contact query per substep
+     */
+    void moveWithProbes(const Vec3& intendedMovement, float deltaTime, IslandChunkSystem* islandSystem);
+    void moveWithContacts(const Vec3& intendedMovement, float deltaTime, IslandChunkSystem* islandSystem);
+    
+    /**
+     * Contact path step-up: start the step animation if the capsule fits on the ledge ahead
+     */
+    bool tryStepUp();
+    
+    /**
+     * Is there a wall in this (unit) direction, for climbing?
+     */
+    bool isWallAhead(const Vec3& direction);
+    
+    /**
+     * Carry the player along with an island's linear and angular velocity
+     */
+    void rideIsland(IslandChunkSystem* islandSystem, uint32_t islandID, float deltaTime);
+    
     /**
      * Gather input direction from keyboard
      */
@@ -280,6 +280,21 @@ void IntegratedServer::sendCompressedChunkToClient(ENetPeer* client, uint32_t is
     sendToClient(client, combinedPacket.data(), combinedPacket.size());
 }
 
+void IntegratedServer::sendChunkUnloadToClient(ENetPeer* client, uint32_t islandID, const std::vector<Vec3>& chunkCoords)
+{
+    if (!client || chunkCoords.empty())
+        return;
+
+    ChunkUnloadHeader header;
+    header.islandID = islandID;
+    header.chunkCount = static_cast<uint32_t>(chunkCoords.size());
+
+    std::vector<uint8_t> packet(sizeof(header) + chunkCoords.size() * sizeof(Vec3));
+    std::memcpy(packet.data(), &header, sizeof(header));
+    std::memcpy(packet.data() + sizeof(header), chunkCoords.data(), chunkCoords.size() * sizeof(Vec3));
+    sendToClient(client, packet.data(), packet.size());
+}
+
 void IntegratedServer::sendToClient(ENetPeer* client, const void* data, size_t size)
 {
     ENetPacket* packet = enet_packet_create(data, size, ENET_PACKET_FLAG_RELIABLE);
@@ -312,6 +327,50 @@ void IntegratedServer::broadcastVoxelChange(uint32_t islandID, const Vec3& local
     broadcastToAllClients(&update, sizeof(update));
 }
 
+void IntegratedServer::broadcastIslandSplit(uint32_t sourceIslandID, const Vec3& brokenVoxelPos, uint32_t fragmentIslandID,
+                                            const Vec3& fragmentPosition, const Vec3& fragmentRotation,
+                                            const Vec3& fragmentVelocity, const Vec3& fragmentAngularVelocity,
+                                            const Vec3& chunkOffset, const std::vector<Vec3>& chunkCoords,
+                                            const uint8_t* chunkVoxels)
+{
+    IslandSplitHeader header;
+    header.sequenceNumber = nextSequenceNumber++;
+    header.sourceIslandID = sourceIslandID;
+    header.brokenVoxelPos = brokenVoxelPos;
+    header.fragmentIslandID = fragmentIslandID;
+    header.fragmentPosition = fragmentPosition;
+    header.fragmentRotation = fragmentRotation;
+    header.fragmentVelocity = fragmentVelocity;
+    header.fragmentAngularVelocity = fragmentAngularVelocity;
+    header.chunkOffset = chunkOffset;
+    header.chunkCount = static_cast<uint32_t>(chunkCoords.size());
+
+    std::vector<uint8_t> packetData(sizeof(header));
+    std::memcpy(packetData.data(), &header, sizeof(header));
+
+    std::vector<uint8_t> compressedData;
+    for (size_t i = 0; i < chunkCoords.size(); ++i)
+    {
+        uint32_t compressedSize = VoxelCompression::compressLZ4(chunkVoxels + i * SPLIT_CHUNK_VOXELS, SPLIT_CHUNK_VOXELS, compressedData);
+        if (compressedSize == 0)
+        {
+            std::cerr << "Failed to compress split chunk for island " << fragmentIslandID << std::endl;
+            return;
+        }
+
+        IslandSplitChunk record;
+        record.chunkCoord = chunkCoords[i];
+        record.compressedSize = compressedSize;
+        const size_t offset = packetData.size();
+        packetData.resize(offset + sizeof(record) + compressedSize);
+        std::memcpy(packetData.data() + offset, &record, sizeof(record));
+        std::memcpy(packetData.data() + offset + sizeof(record), compressedData.data(), compressedSize);
+    }
+
+    // broadcastToAllClients hands the same packet to every peer
+    broadcastToAllClients(packetData.data(), packetData.size());
+}
+
 void IntegratedServer::broadcastEntityState(const EntityStateUpdate& entityState)
 {
     broadcastToAllClients(&entityState, sizeof(entityState));
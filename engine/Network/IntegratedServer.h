@@ -36,7 +36,15 @@ public:
     // NEW: Send individual chunk with coordinates for multi-chunk islands
     void sendCompressedChunkToClient(ENetPeer* client, uint32_t islandID, const Vec3& chunkCoord, const Vec3& islandPosition, const uint8_t* voxelData, uint32_t voxelDataSize);
     
+    // One CHUNK_UNLOAD packet per island: chunks the client should drop
+    void sendChunkUnloadToClient(ENetPeer* client, uint32_t islandID, const std::vector<Vec3>& chunkCoords);
+    
     void broadcastVoxelChange(uint32_t islandID, const Vec3& localPos, uint8_t voxelType, uint32_t authorPlayerId);
+    // One ISLAND_SPLIT packet for every client: chunk payloads (SPLIT_CHUNK_VOXELS bytes each) compressed once
+    void broadcastIslandSplit(uint32_t sourceIslandID, const Vec3& brokenVoxelPos, uint32_t fragmentIslandID,
+                              const Vec3& fragmentPosition, const Vec3& fragmentRotation, const Vec3& fragmentVelocity,
+                              const Vec3& fragmentAngularVelocity, const Vec3& chunkOffset,
+                              const std::vector<Vec3>& chunkCoords, const uint8_t* chunkVoxels);
     void broadcastEntityState(const EntityStateUpdate& entityState);
     void sendToClient(ENetPeer* client, const void* data, size_t size);
     void broadcastToAllClients(const void* data, size_t size);
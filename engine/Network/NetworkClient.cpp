@@ -313,6 +313,77 @@ void NetworkClient::processServerMessage(ENetPacket* packet)
             break;
         }
 
+        case NetworkMessageType::ISLAND_SPLIT:
+        {
+            if (packet->dataLength >= sizeof(IslandSplitHeader))
+            {
+                IslandSplitHeader header = *(IslandSplitHeader*) packet->data;
+                if (header.chunkCount > (packet->dataLength - sizeof(IslandSplitHeader)) / sizeof(IslandSplitChunk))
+                {
+                    std::cerr << "Malformed island split packet for island " << header.sourceIslandID << std::endl;
+                    break;
+                }
+
+                // Chunk records follow the header back to back
+                std::vector<Vec3> chunkCoords;
+                std::vector<uint8_t> chunkVoxels(static_cast<size_t>(header.chunkCount) * SPLIT_CHUNK_VOXELS);
+                chunkCoords.reserve(header.chunkCount);
+                size_t offset = sizeof(IslandSplitHeader);
+                bool valid = true;
+                for (uint32_t i = 0; i < header.chunkCount && valid; ++i)
+                {
+                    if (packet->dataLength - offset < sizeof(IslandSplitChunk))
+                    {
+                        valid = false;
+                        break;
+                    }
+                    IslandSplitChunk record = *(IslandSplitChunk*) (packet->data + offset);
+                    offset += sizeof(IslandSplitChunk);
+                    if (packet->dataLength - offset < record.compressedSize)
+                    {
+                        valid = false;
+                        break;
+                    }
+                    valid = VoxelCompression::decompressLZ4(packet->data + offset, record.compressedSize,
+                                                            chunkVoxels.data() + i * SPLIT_CHUNK_VOXELS,
+                                                            SPLIT_CHUNK_VOXELS);
+                    offset += record.compressedSize;
+                    chunkCoords.push_back(record.chunkCoord);
+                }
+
+                if (!valid)
+                {
+                    std::cerr << "Malformed island split packet for island " << header.sourceIslandID << std::endl;
+                }
+                else if (onIslandSplitReceived)
+                {
+                    onIslandSplitReceived(header, chunkCoords, chunkVoxels);
+                }
+            }
+            break;
+        }
+
+        case NetworkMessageType::CHUNK_UNLOAD:
+        {
+            if (packet->dataLength >= sizeof(ChunkUnloadHeader))
+            {
+                ChunkUnloadHeader header = *(ChunkUnloadHeader*) packet->data;
+                if (header.chunkCount > (packet->dataLength - sizeof(ChunkUnloadHeader)) / sizeof(Vec3))
+                {
+                    std::cerr << "Malformed chunk unload packet for island " << header.islandID << std::endl;
+                    break;
+                }
+
+                std::vector<Vec3> chunkCoords(header.chunkCount);
+                std::memcpy(chunkCoords.data(), packet->data + sizeof(ChunkUnloadHeader), header.chunkCount * sizeof(Vec3));
+                if (onChunkUnloadReceived)
+                {
+                    onChunkUnloadReceived(header.islandID, chunkCoords);
+                }
+            }
+            break;
+        }
+
         default:
             std::cout << "Unknown message type from server: " << (int) messageType << std::endl;
             break;
@@ -3,6 +3,7 @@
 #include "NetworkMessages.h"
 #include <functional>
 #include <string>
+#include <vector>
 #include <cstdint>
 
 /**
@@ -47,6 +48,12 @@ public:
     std::function<void(const VoxelChangeUpdate&)> onVoxelChangeReceived;
     std::function<void(const EntityStateUpdate&)> onEntityStateUpdate;
     
+    // Island split: header, source chunk coords and their decoded payloads (SPLIT_CHUNK_VOXELS bytes each)
+    std::function<void(const IslandSplitHeader&, const std::vector<Vec3>&, const std::vector<uint8_t>&)> onIslandSplitReceived;
+    
+    // Chunks of an island that left the streaming range: island ID, chunk coords
+    std::function<void(uint32_t, const std::vector<Vec3>&)> onChunkUnloadReceived;
+    
 private:
     void handleServerEvent(const ENetEvent& event);
     void processServerMessage(ENetPacket* packet);
@@ -23,7 +23,9 @@ enum NetworkMessageType : uint8_t {
     VOXEL_CHANGE_REQUEST = 8,          // Updated numbering
     VOXEL_CHANGE_UPDATE = 9,
     ENTITY_STATE_UPDATE = 10,
-    PILOTING_INPUT = 11
+    PILOTING_INPUT = 11,
+    ISLAND_SPLIT = 12,                 // Block break that cut a fragment off into a new island
+    CHUNK_UNLOAD = 13                  // Chunks that left the client's streaming range
 };
 
 // Simple hello world message
@@ -109,6 +111,39 @@ struct PACKED VoxelChangeUpdate {
     uint32_t authorPlayerId; // Player who made the change
 };
 
+// Island split from server to all clients - replaces the block break's VoxelChangeUpdate, the
+// per-voxel removals and the new island's chunk stream with one packet built once for every peer.
+// Clients clear brokenVoxelPos, then apply the chunk records: each decodes to one chunk of voxels where solid
+// voxels move from the source chunk into fragment chunk (chunkCoord - chunkOffset), types included.
+struct PACKED IslandSplitHeader {
+    uint8_t type = ISLAND_SPLIT;
+    uint32_t sequenceNumber;
+    uint32_t sourceIslandID;
+    Vec3 brokenVoxelPos;            // The break that caused the split (island-relative)
+    uint32_t fragmentIslandID;
+    Vec3 fragmentPosition;          // Fragment physics center
+    Vec3 fragmentRotation;          // Euler angles, as the source's at the split
+    Vec3 fragmentVelocity;
+    Vec3 fragmentAngularVelocity;
+    Vec3 chunkOffset;               // Whole chunks between source and fragment chunk coords
+    uint32_t chunkCount;            // IslandSplitChunk records that follow
+};
+
+struct PACKED IslandSplitChunk {
+    Vec3 chunkCoord;                // Source-island chunk coordinate
+    uint32_t compressedSize;        // LZ4 bytes that follow (SPLIT_CHUNK_VOXELS decoded)
+};
+
+constexpr uint32_t SPLIT_CHUNK_VOXELS = 16 * 16 * 16;
+
+// Chunks of one island that left the client's streaming range - the client drops them, and the
+// server sends them again (COMPRESSED_CHUNK_DATA) if they come back into range
+struct PACKED ChunkUnloadHeader {
+    uint8_t type = CHUNK_UNLOAD;
+    uint32_t islandID;
+    uint32_t chunkCount;            // Vec3 chunk coordinates that follow
+};
+
 // Unified entity state update (works for players, islands, NPCs, etc.)
 struct PACKED EntityStateUpdate {
     uint8_t type = ENTITY_STATE_UPDATE;
@@ -1,8 +1,9 @@
 // PhysicsSystem.cpp - Basic collision detection system
 #include "PhysicsSystem.h"
 
-#include <iostream>
+#include <algorithm>
 #include <cmath>
+#include <iostream>
 
 #include "../World/IslandChunkSystem.h"
 #include "../World/VoxelChunk.h"
@@ -41,16 +42,17 @@ bool PhysicsSystem::checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDire
     if (!m_islandSystem)
         return false;
 
-    // Check ray collision with all active islands
-    const auto& islands = m_islandSystem->getIslands();
-    for (const auto& islandPair : islands)
+    // Check ray collision with the islands the ray can reach (broadphase)
+    std::vector<uint32_t> candidates;
+    m_islandSystem->queryIslandsAlongRay(rayOrigin, rayDirection, maxDistance, candidates);
+    for (uint32_t islandID : candidates)
     {
-        const FloatingIsland* island = &islandPair.second;
+        const FloatingIsland* island = m_islandSystem->getIsland(islandID);
         if (!island)
             continue;
 
         // Convert ray origin to island-local coordinates
-        Vec3 localRayOrigin = rayOrigin - island->physicsCenter;
+        Vec3 localRayOrigin = rayOrigin - island->getPhysicsCenter();
         Vec3 rayEnd = localRayOrigin + (rayDirection * maxDistance);
         
         // Calculate bounding box of ray path
@@ -76,7 +78,7 @@ bool PhysicsSystem::checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDire
             {
                 for (int chunkZ = minChunkZ; chunkZ <= maxChunkZ; ++chunkZ)
                 {
-                    Vec3 chunkCoord(chunkX, chunkY, chunkZ);
+                    ChunkCoord chunkCoord(chunkX, chunkY, chunkZ);
                     
                     // Check if this chunk exists in the island
                     auto chunkIt = island->chunks.find(chunkCoord);
@@ -84,7 +86,7 @@ bool PhysicsSystem::checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDire
                         continue;
 
                     // Calculate chunk world position
-                    Vec3 chunkWorldPos = island->physicsCenter + FloatingIsland::chunkCoordToWorldPos(chunkCoord);
+                    Vec3 chunkWorldPos = island->getPhysicsCenter() + FloatingIsland::chunkCoordToWorldPos(chunkCoord);
                     
                     // Convert ray to chunk-local coordinates
                     Vec3 chunkLocalRayOrigin = rayOrigin - chunkWorldPos;
@@ -135,7 +137,7 @@ void PhysicsSystem::debugCollisionInfo(const Vec3& playerPos, float playerRadius
         const FloatingIsland* island = &islandPair.second;
         if (!island) continue;
 
-        std::cout << "Island " << islandPair.first << " at (" << island->physicsCenter.x << ", " << island->physicsCenter.y << ", " << island->physicsCenter.z << ")" << std::endl;
+        std::cout << "Island " << islandPair.first << " at (" << island->getPhysicsCenter().x << ", " << island->getPhysicsCenter().y << ", " << island->getPhysicsCenter().z << ")" << std::endl;
         std::cout << "  Chunks: " << island->chunks.size() << std::endl;
 
         for (const auto& chunkPair : island->chunks)
@@ -216,7 +218,7 @@ bool PhysicsSystem::checkChunkCapsuleCollision(const VoxelChunk* chunk, const Ve
         // 3. The bottom hemisphere
         
         // Quick reject: if center is too far from plane
-        if (abs(distanceToPlane) > (height * 0.5f + 0.1f))
+        if (std::abs(distanceToPlane) > (height * 0.5f + 0.1f))
             continue;
         
         // Determine which part of the capsule to test based on face position
@@ -245,7 +247,7 @@ bool PhysicsSystem::checkChunkCapsuleCollision(const VoxelChunk* chunk, const Ve
         Vec3 faceToPoint = closestPointOnAxis - face.position;
         float distToPlane = faceToPoint.dot(face.normal);
         
-        if (abs(distToPlane) <= radius)
+        if (std::abs(distToPlane) <= radius)
         {
             // Project point onto face plane
             Vec3 projectedPoint = closestPointOnAxis - face.normal * distToPlane;
@@ -253,23 +255,23 @@ bool PhysicsSystem::checkChunkCapsuleCollision(const VoxelChunk* chunk, const Ve
             
             // Check if projected point overlaps with 1x1 face bounds
             bool withinBounds = true;
-            if (abs(face.normal.x) > 0.5f)
+            if (std::abs(face.normal.x) > 0.5f)
             {
                 // X-facing face - check YZ circle overlap
-                withinBounds = (abs(localPoint.y) <= (0.5f + radius)) && 
-                              (abs(localPoint.z) <= (0.5f + radius));
+                withinBounds = (std::abs(localPoint.y) <= (0.5f + radius)) && 
+                              (std::abs(localPoint.z) <= (0.5f + radius));
             }
-            else if (abs(face.normal.z) > 0.5f)
+            else if (std::abs(face.normal.z) > 0.5f)
             {
                 // Z-facing face - check XY circle overlap
-                withinBounds = (abs(localPoint.x) <= (0.5f + radius)) && 
-                              (abs(localPoint.y) <= (0.5f + radius));
+                withinBounds = (std::abs(localPoint.x) <= (0.5f + radius)) && 
+                              (std::abs(localPoint.y) <= (0.5f + radius));
             }
             else
             {
                 // Y-facing face - check XZ circle overlap
-                withinBounds = (abs(localPoint.x) <= (0.5f + radius)) && 
-                              (abs(localPoint.z) <= (0.5f + radius));
+                withinBounds = (std::abs(localPoint.x) <= (0.5f + radius)) && 
+                              (std::abs(localPoint.z) <= (0.5f + radius));
             }
             
             if (withinBounds)
@@ -283,24 +285,366 @@ bool PhysicsSystem::checkChunkCapsuleCollision(const VoxelChunk* chunk, const Ve
     return false;
 }
 
+// Signed distance along one axis from voxel cell [cell, cell + 1] to the capsule's extent [low, high]
+// on that axis: positive when the capsule lies above the cell, negative below, 0 when they overlap
+static float axisGap(float low, float high, int cell)
+{
+    if (low > cell + 1.0f)
+        return low - (cell + 1.0f);
+    if (high < static_cast<float>(cell))
+        return high - cell;
+    return 0.0f;
+}
+
+// Axis-aligned unit vector along the largest component (faces are axis-aligned too)
+static Vec3 dominantAxis(const Vec3& v)
+{
+    const float ax = std::abs(v.x);
+    const float ay = std::abs(v.y);
+    const float az = std::abs(v.z);
+    if (ay >= ax && ay >= az)
+        return Vec3(0, v.y < 0.0f ? -1.0f : 1.0f, 0);
+    if (ax >= az)
+        return Vec3(v.x < 0.0f ? -1.0f : 1.0f, 0, 0);
+    return Vec3(0, 0, v.z < 0.0f ? -1.0f : 1.0f);
+}
+
+// Solid voxel at chunk-local (x, y, z), at most one cell outside the chunk (read from the face neighbor)
+static bool isSolidCell(const VoxelChunk& chunk, const CollisionMesh& collision, int x, int y, int z)
+{
+    constexpr int SIZE = VoxelChunk::SIZE;
+    int face = -1;  // VoxelChunk face order: 0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X
+    if (y < 0) face = 0;
+    else if (y >= SIZE) face = 1;
+    else if (z < 0) face = 2;
+    else if (z >= SIZE) face = 3;
+    else if (x < 0) face = 4;
+    else if (x >= SIZE) face = 5;
+    if (face < 0)
+        return (collision.solidRows[y + z * SIZE] >> x) & 1u;
+
+    const VoxelChunk* neighbor = chunk.getNeighbor(face);
+    auto neighborCollision = neighbor ? neighbor->getCollisionMesh() : nullptr;
+    if (!neighborCollision)
+        return false;
+    const int nx = (x + SIZE) % SIZE;
+    const int ny = (y + SIZE) % SIZE;
+    const int nz = (z + SIZE) % SIZE;
+    return (neighborCollision->solidRows[ny + nz * SIZE] >> nx) & 1u;
+}
+
+static inline int lowestSetBit(uint32_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+namespace
+{
+// The capsule is every point within radius of a vertical segment
+struct CapsuleSegment
+{
+    Vec3 center;
+    float minY;
+    float maxY;
+    float radius;
+
+    CapsuleSegment(const Vec3& capsuleCenter, float capsuleRadius, float height)
+        : center(capsuleCenter), radius(capsuleRadius)
+    {
+        const float cylinderHalfHeight = std::max(0.0f, (height - 2.0f * capsuleRadius) * 0.5f);
+        minY = capsuleCenter.y - cylinderHalfHeight;
+        maxY = capsuleCenter.y + cylinderHalfHeight;
+    }
+};
+}
+
+// Calls visit(x, y, z, gap) for each solid cell of the chunk within `reach` of the segment (chunk-local
+// capsule), gap being the signed per-axis separation; stops early when visit returns true
+template <typename Visitor>
+static bool forEachSolidCellInReach(const CollisionMesh& collision, const CapsuleSegment& capsule, float reach,
+                                    Visitor&& visit)
+{
+    constexpr int SIZE = VoxelChunk::SIZE;
+    const Vec3& center = capsule.center;
+
+    // Cells under the reach box (voxel x spans [x, x + 1]), clamped to this chunk
+    const int minX = std::max(0, static_cast<int>(std::floor(center.x - reach)));
+    const int maxX = std::min(SIZE - 1, static_cast<int>(std::floor(center.x + reach)));
+    const int minY = std::max(0, static_cast<int>(std::floor(capsule.minY - reach)));
+    const int maxY = std::min(SIZE - 1, static_cast<int>(std::floor(capsule.maxY + reach)));
+    const int minZ = std::max(0, static_cast<int>(std::floor(center.z - reach)));
+    const int maxZ = std::min(SIZE - 1, static_cast<int>(std::floor(center.z + reach)));
+    if (minX > maxX || minY > maxY || minZ > maxZ)
+        return false;
+    const uint32_t columnMask = ((2u << maxX) - 1u) & ~((1u << minX) - 1u);
+    const float reachSq = reach * reach;
+
+    for (int z = minZ; z <= maxZ; ++z)
+    {
+        const float gapZ = axisGap(center.z, center.z, z);
+        for (int y = minY; y <= maxY; ++y)
+        {
+            uint32_t bits = collision.solidRows[y + z * SIZE] & columnMask;
+            if (bits == 0)
+                continue;
+
+            // Segment-to-box distance splits per axis: the whole row shares its Y and Z gaps
+            const float gapY = axisGap(capsule.minY, capsule.maxY, y);
+            const float rowDistanceSq = gapY * gapY + gapZ * gapZ;
+            if (rowDistanceSq > reachSq)
+                continue;
+
+            for (; bits != 0; bits &= bits - 1)
+            {
+                const int x = lowestSetBit(bits);
+                const float gapX = axisGap(center.x, center.x, x);
+                if (rowDistanceSq + gapX * gapX > reachSq)
+                    continue;
+                if (visit(x, y, z, Vec3(gapX, gapY, gapZ)))
+                    return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Contact (chunk-local) of the capsule with one solid cell. Faces against a solid neighbor are no
+// surface, so separation across them is dropped - flat ground reads as flat across voxel seams
+// (exact while the reach stays under one voxel). False for a cell with no exposed face; its
+// neighbors report the contact.
+static bool cellContact(const VoxelChunk& chunk, const CollisionMesh& collision, const CapsuleSegment& capsule,
+                        int x, int y, int z, const Vec3& gap, CapsuleContact& outContact)
+{
+    // Segment point nearest the cell
+    const float axisY = gap.y > 0.0f   ? capsule.minY
+                        : gap.y < 0.0f ? capsule.maxY
+                                       : 0.5f * (std::max(capsule.minY, static_cast<float>(y)) +
+                                                 std::min(capsule.maxY, y + 1.0f));
+    const Vec3 axisPoint(capsule.center.x, axisY, capsule.center.z);
+
+    Vec3 separation = gap;
+    if (separation.x != 0.0f && isSolidCell(chunk, collision, x + (separation.x < 0.0f ? -1 : 1), y, z))
+        separation.x = 0.0f;
+    if (separation.y != 0.0f && isSolidCell(chunk, collision, x, y + (separation.y < 0.0f ? -1 : 1), z))
+        separation.y = 0.0f;
+    if (separation.z != 0.0f && isSolidCell(chunk, collision, x, y, z + (separation.z < 0.0f ? -1 : 1)))
+        separation.z = 0.0f;
+
+    const float distance = separation.length();
+    if (distance > 0.0f)
+    {
+        outContact.normal = separation / distance;
+        outContact.depth = capsule.radius - distance;
+        outContact.point = axisPoint - separation;
+        return true;
+    }
+
+    // Segment inside the cell (or only separated across solid neighbors): out through the nearest exposed face
+    static const int FACE_OFFSETS[6][3] = {{0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}, {-1, 0, 0}, {1, 0, 0}};
+    const float exits[6] = {capsule.maxY - y,         (y + 1.0f) - capsule.minY, capsule.center.z - z,
+                            (z + 1.0f) - capsule.center.z, capsule.center.x - x,  (x + 1.0f) - capsule.center.x};
+    const float planes[6] = {static_cast<float>(y), y + 1.0f, static_cast<float>(z),
+                             z + 1.0f,              static_cast<float>(x), x + 1.0f};
+    int best = -1;
+    for (int face = 0; face < 6; ++face)
+    {
+        const int* offset = FACE_OFFSETS[face];
+        if (isSolidCell(chunk, collision, x + offset[0], y + offset[1], z + offset[2]))
+            continue;
+        if (best < 0 || exits[face] < exits[best])
+            best = face;
+    }
+    if (best < 0)
+        return false;
+
+    outContact.normal = Vec3(static_cast<float>(FACE_OFFSETS[best][0]), static_cast<float>(FACE_OFFSETS[best][1]),
+                             static_cast<float>(FACE_OFFSETS[best][2]));
+    outContact.depth = capsule.radius + exits[best];
+    outContact.point = axisPoint;
+    if (best < 2)
+        outContact.point.y = planes[best];
+    else if (best < 4)
+        outContact.point.z = planes[best];
+    else
+        outContact.point.x = planes[best];
+    return true;
+}
+
+bool PhysicsSystem::checkChunkCapsuleOccupancy(const VoxelChunk& chunk, const CollisionMesh& collision,
+                                               const Vec3& capsuleCenter, float radius, float height, Vec3& outNormal)
+{
+    const CapsuleSegment capsule(capsuleCenter, radius, height);
+    return forEachSolidCellInReach(collision, capsule, radius, [&](int x, int y, int z, const Vec3& gap) {
+        // Push out along the contact normal's main axis (away from the cell center if the cell is buried)
+        CapsuleContact contact;
+        if (cellContact(chunk, collision, capsule, x, y, z, gap, contact))
+            outNormal = dominantAxis(contact.normal);
+        else
+            outNormal = dominantAxis(capsuleCenter - Vec3(x + 0.5f, y + 0.5f, z + 0.5f));
+        return true;
+    });
+}
+
+void PhysicsSystem::gatherChunkCapsuleContacts(const VoxelChunk& chunk, const CollisionMesh& collision,
+                                               const Vec3& capsuleCenter, float radius, float height, float margin,
+                                               std::vector<CapsuleContact>& outContacts)
+{
+    const CapsuleSegment capsule(capsuleCenter, radius, height);
+    forEachSolidCellInReach(collision, capsule, radius + margin, [&](int x, int y, int z, const Vec3& gap) {
+        CapsuleContact contact;
+        if (cellContact(chunk, collision, capsule, x, y, z, gap, contact) && contact.depth >= -margin)
+            outContacts.push_back(contact);
+        return false;
+    });
+}
+
+// Calls visit(chunk, collision, chunkOffset) for each chunk of the island under the box around the
+// island-local point; stops early when visit returns true
+template <typename Visitor>
+static bool forEachChunkInBox(const FloatingIsland& island, const Vec3& center, const Vec3& extent, Visitor&& visit)
+{
+    const ChunkCoord minChunk = FloatingIsland::islandPosToChunkCoord(center - extent);
+    const ChunkCoord maxChunk = FloatingIsland::islandPosToChunkCoord(center + extent);
+
+    for (int chunkZ = minChunk.z; chunkZ <= maxChunk.z; ++chunkZ)
+    {
+        for (int chunkY = minChunk.y; chunkY <= maxChunk.y; ++chunkY)
+        {
+            for (int chunkX = minChunk.x; chunkX <= maxChunk.x; ++chunkX)
+            {
+                const ChunkCoord chunkCoord(chunkX, chunkY, chunkZ);
+                auto chunkIt = island.chunks.find(chunkCoord);
+                if (chunkIt == island.chunks.end() || !chunkIt->second)
+                    continue;
+
+                // Grid published with the collision faces (thread-safe atomic load)
+                auto collision = chunkIt->second->getCollisionMesh();
+                if (!collision)
+                    continue;
+
+                if (visit(*chunkIt->second, *collision, FloatingIsland::chunkCoordToWorldPos(chunkCoord)))
+                    return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PhysicsSystem::checkIslandCapsuleOccupancy(const FloatingIsland& island, const Vec3& capsuleCenter, float radius,
+                                                float height, Vec3& outNormal)
+{
+    const Vec3 extent(radius, std::max(height * 0.5f, radius), radius);
+    return forEachChunkInBox(island, capsuleCenter, extent,
+                             [&](const VoxelChunk& chunk, const CollisionMesh& collision, const Vec3& chunkOffset) {
+                                 Vec3 normalLocal;
+                                 if (!checkChunkCapsuleOccupancy(chunk, collision, capsuleCenter - chunkOffset, radius,
+                                                                 height, normalLocal))
+                                     return false;
+                                 outNormal = island.localDirToWorld(normalLocal);
+                                 return true;
+                             });
+}
+
+size_t PhysicsSystem::queryCapsuleContacts(const Vec3& capsuleCenter, float radius, float height,
+                                           std::vector<CapsuleContact>& outContacts, float margin)
+{
+    PROFILE_FUNCTION();
+    m_capsuleQueries.fetch_add(1, std::memory_order_relaxed);
+    const size_t first = outContacts.size();
+    if (!m_islandSystem)
+        return 0;
+
+    const Vec3 capsuleExtent(radius + margin, height * 0.5f + margin, radius + margin);
+    std::vector<uint32_t> candidates;
+    m_islandSystem->queryIslandsInBox(capsuleCenter - capsuleExtent, capsuleCenter + capsuleExtent, candidates);
+
+    std::vector<CapsuleContact> islandContacts;
+    for (uint32_t islandID : candidates)
+    {
+        const FloatingIsland* island = m_islandSystem->getIsland(islandID);
+        if (!island)
+            continue;
+
+        // Gathered island-local, then reduced to one contact per distinct normal (the deepest)
+        const Vec3 localPos = island->worldToLocal(capsuleCenter);
+        islandContacts.clear();
+        forEachChunkInBox(*island, localPos, capsuleExtent,
+                          [&](const VoxelChunk& chunk, const CollisionMesh& collision, const Vec3& chunkOffset) {
+                              const size_t chunkFirst = islandContacts.size();
+                              gatherChunkCapsuleContacts(chunk, collision, localPos - chunkOffset, radius, height,
+                                                         margin, islandContacts);
+                              for (size_t i = chunkFirst; i < islandContacts.size(); ++i)
+                                  islandContacts[i].point += chunkOffset;
+                              return false;
+                          });
+
+        const size_t islandFirst = outContacts.size();
+        for (CapsuleContact& contact : islandContacts)
+        {
+            auto same = std::find_if(outContacts.begin() + islandFirst, outContacts.end(), [&](const CapsuleContact& kept) {
+                return kept.normal.dot(contact.normal) > CONTACT_NORMAL_MERGE;
+            });
+            if (same == outContacts.end())
+                outContacts.push_back(contact);
+            else if (contact.depth > same->depth)
+                *same = contact;
+        }
+
+        for (size_t i = islandFirst; i < outContacts.size(); ++i)
+        {
+            outContacts[i].normal = island->localDirToWorld(outContacts[i].normal);
+            outContacts[i].point = island->localToWorld(outContacts[i].point);
+            outContacts[i].island = island;
+        }
+    }
+
+    // Deepest first - the order a solver wants to resolve them in
+    std::sort(outContacts.begin() + first, outContacts.end(),
+              [](const CapsuleContact& a, const CapsuleContact& b) { return a.depth > b.depth; });
+    return outContacts.size() - first;
+}
+
 bool PhysicsSystem::checkCapsuleCollision(const Vec3& capsuleCenter, float radius, float height,
                                          Vec3& outNormal, const FloatingIsland** outIsland)
 {
     PROFILE_FUNCTION();
+    m_capsuleQueries.fetch_add(1, std::memory_order_relaxed);
     if (!m_islandSystem)
         return false;
     
-    const auto& islands = m_islandSystem->getIslands();
+    // Only islands whose bounds touch the capsule's box (broadphase)
+    const Vec3 capsuleExtent(radius, height * 0.5f, radius);
+    std::vector<uint32_t> candidates;
+    m_islandSystem->queryIslandsInBox(capsuleCenter - capsuleExtent, capsuleCenter + capsuleExtent, candidates);
     
-    for (const auto& islandPair : islands)
+    for (uint32_t islandID : candidates)
     {
-        const FloatingIsland* island = &islandPair.second;
+        const FloatingIsland* island = m_islandSystem->getIsland(islandID);
         if (!island)
             continue;
         
         // Transform world-space capsule to island-local space (accounts for rotation!)
         Vec3 localPos = island->worldToLocal(capsuleCenter);
         
+        if (m_capsuleMode == CapsuleCollisionMode::OccupancyGrid)
+        {
+            if (checkIslandCapsuleOccupancy(*island, localPos, radius, height, outNormal))
+            {
+                if (outIsland)
+                    *outIsland = island;
+                return true;
+            }
+            continue;
+        }
+        
         // Calculate chunk bounds - capsule can span multiple chunks vertically
         float checkRadius = radius + VoxelChunk::SIZE;
         float checkHeight = height * 0.5f + VoxelChunk::SIZE;
@@ -318,7 +662,7 @@ bool PhysicsSystem::checkCapsuleCollision(const Vec3& capsuleCenter, float radiu
             {
                 for (int chunkZ = minChunkZ; chunkZ <= maxChunkZ; ++chunkZ)
                 {
-                    Vec3 chunkCoord(chunkX, chunkY, chunkZ);
+                    ChunkCoord chunkCoord(chunkX, chunkY, chunkZ);
                     auto chunkIt = island->chunks.find(chunkCoord);
                     if (chunkIt == island->chunks.end() || !chunkIt->second)
                         continue;
@@ -330,7 +674,7 @@ bool PhysicsSystem::checkCapsuleCollision(const Vec3& capsuleCenter, float radiu
                     Vec3 collisionNormalLocal;
                     // NOTE: We're passing world positions for backward compatibility
                     // but collision detection now happens in island-local space
-                    Vec3 chunkWorldPos = island->physicsCenter + chunkLocalOffset;
+                    Vec3 chunkWorldPos = island->getPhysicsCenter() + chunkLocalOffset;
                     if (checkChunkCapsuleCollision(chunkIt->second.get(), capsuleInChunkLocal, chunkWorldPos,
                                                    collisionNormalLocal, radius, height))
                     {
@@ -351,6 +695,7 @@ bool PhysicsSystem::checkCapsuleCollision(const Vec3& capsuleCenter, float radiu
 GroundInfo PhysicsSystem::detectGroundCapsule(const Vec3& capsuleCenter, float radius, float height, float rayMargin)
 {
     PROFILE_FUNCTION();
+    m_capsuleQueries.fetch_add(1, std::memory_order_relaxed);
     GroundInfo info;
     info.isGrounded = false;
     
@@ -366,12 +711,14 @@ GroundInfo PhysicsSystem::detectGroundCapsule(const Vec3& capsuleCenter, float r
     Vec3 rayDirection = Vec3(0, -1, 0);
     float rayLength = rayMargin;
     
-    // Check all islands
-    const auto& islands = m_islandSystem->getIslands();
+    // Check the islands under the ray's footprint (broadphase)
+    std::vector<uint32_t> candidates;
+    m_islandSystem->queryIslandsInBox(Vec3(rayOrigin.x - radius, rayOrigin.y - rayLength, rayOrigin.z - radius),
+                                      Vec3(rayOrigin.x + radius, rayOrigin.y, rayOrigin.z + radius), candidates);
     
-    for (const auto& islandPair : islands)
+    for (uint32_t islandID : candidates)
     {
-        const FloatingIsland* island = &islandPair.second;
+        const FloatingIsland* island = m_islandSystem->getIsland(islandID);
         if (!island)
             continue;
         
@@ -394,7 +741,7 @@ GroundInfo PhysicsSystem::detectGroundCapsule(const Vec3& capsuleCenter, float r
             {
                 for (int chunkZ = minChunkZ; chunkZ <= maxChunkZ; ++chunkZ)
                 {
-                    Vec3 chunkCoord(chunkX, chunkY, chunkZ);
+                    ChunkCoord chunkCoord(chunkX, chunkY, chunkZ);
                     auto chunkIt = island->chunks.find(chunkCoord);
                     if (chunkIt == island->chunks.end() || !chunkIt->second)
                         continue;
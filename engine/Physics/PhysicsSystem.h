@@ -2,11 +2,15 @@
 #pragma once
 #include "ECS/ECS.h"
 #include "Math/Vec3.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 // Forward declarations
 class IslandChunkSystem;
 class VoxelChunk;
+struct CollisionMesh;
 struct FloatingIsland;
 
 // Ground detection information for player physics
@@ -20,6 +24,15 @@ struct GroundInfo
     float distanceToGround = 999.0f;      // Distance to ground (for coyote time, etc.)
 };
 
+// One contact between a capsule and an island's voxels (world space)
+struct CapsuleContact
+{
+    Vec3 normal = Vec3(0, 1, 0);             // Out of the surface, toward the capsule (unit length)
+    float depth = 0.0f;                      // Penetration along normal; negative = gap (within the query margin)
+    Vec3 point = Vec3(0, 0, 0);              // Touching point on the voxel surface
+    const FloatingIsland* island = nullptr;  // Owning island (its velocity moves the surface)
+};
+
 // Simple collision detection system using voxel face culling
 class PhysicsSystem
 {
@@ -27,6 +40,16 @@ class PhysicsSystem
     PhysicsSystem();
     ~PhysicsSystem();
 
+    // Capsule narrow phase. OccupancyGrid tests the capsule against the solid voxels under its box;
+    // CollisionMesh is the original per-face loop, kept for A/B comparison (--collision-faces)
+    enum class CapsuleCollisionMode : uint8_t
+    {
+        OccupancyGrid,
+        CollisionMesh
+    };
+    void setCapsuleCollisionMode(CapsuleCollisionMode mode) { m_capsuleMode = mode; }
+    CapsuleCollisionMode getCapsuleCollisionMode() const { return m_capsuleMode; }
+
     bool initialize();
     void update(float deltaTime);
     void updateEntities(float deltaTime);
@@ -37,6 +60,16 @@ class PhysicsSystem
     // Height is total height including hemispherical caps
     bool checkCapsuleCollision(const Vec3& capsuleCenter, float radius, float height, Vec3& outNormal, const FloatingIsland** outIsland = nullptr);
     GroundInfo detectGroundCapsule(const Vec3& capsuleCenter, float radius, float height, float rayMargin = 0.1f);
+
+    // Full contact set of a capsule, appended deepest first; returns how many. One contact per island and
+    // distinct normal (the deepest), so pushing the capsule out along each normal by its depth separates
+    // it. Contacts up to `margin` away are included with negative depth (ground / wall sensing without
+    // a second query). Always uses the occupancy grids, whatever the capsule collision mode.
+    size_t queryCapsuleContacts(const Vec3& capsuleCenter, float radius, float height,
+                                std::vector<CapsuleContact>& outContacts, float margin = 0.0f);
+
+    // Capsule queries (collision, ground, contacts) since the last call - the per-frame query count
+    uint32_t takeCapsuleQueryCount() { return m_capsuleQueries.exchange(0, std::memory_order_relaxed); }
     
     // Raycasting
     bool checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDirection, float maxDistance, Vec3& hitPoint, Vec3& hitNormal);
@@ -50,10 +83,24 @@ class PhysicsSystem
 
    private:
     IslandChunkSystem* m_islandSystem = nullptr;
+    CapsuleCollisionMode m_capsuleMode = CapsuleCollisionMode::OccupancyGrid;
+    std::atomic<uint32_t> m_capsuleQueries{0};
+
+    static constexpr float CONTACT_NORMAL_MERGE = 0.999f;  // Contacts whose normals agree this closely are one
     
     // Helper methods for capsule collision
     bool checkChunkCapsuleCollision(const VoxelChunk* chunk, const Vec3& capsuleCenter, const Vec3& chunkWorldPos,
                                    Vec3& outNormal, float radius, float height);
+    // Capsule (island-local) against the occupancy grids of only the chunks its box overlaps
+    static bool checkIslandCapsuleOccupancy(const FloatingIsland& island, const Vec3& capsuleCenter, float radius,
+                                            float height, Vec3& outNormal);
+    // Capsule (chunk-local) against the chunk's occupancy grid - exact capsule vs voxel box distance
+    static bool checkChunkCapsuleOccupancy(const VoxelChunk& chunk, const CollisionMesh& collision,
+                                           const Vec3& capsuleCenter, float radius, float height, Vec3& outNormal);
+    // Contacts (chunk-local) of every solid cell within radius + margin, unmerged
+    static void gatherChunkCapsuleContacts(const VoxelChunk& chunk, const CollisionMesh& collision,
+                                           const Vec3& capsuleCenter, float radius, float height, float margin,
+                                           std::vector<CapsuleContact>& outContacts);
 };
 
 // Global physics system
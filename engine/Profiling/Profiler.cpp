@@ -91,10 +91,27 @@ const Profiler::ProfileData* Profiler::getProfileData(const std::string& name) c
     return (it != m_profiles.end()) ? &it->second : nullptr;
 }
 
+void Profiler::setCounter(const std::string& name, int64_t value)
+{
+    if (!m_enabled)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_profileMutex);
+    m_counters[name] = value;
+}
+
+int64_t Profiler::getCounter(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_profileMutex);
+    auto it = m_counters.find(name);
+    return (it != m_counters.end()) ? it->second : 0;
+}
+
 void Profiler::clearAll()
 {
     std::lock_guard<std::mutex> lock(m_profileMutex);
     m_profiles.clear();
+    m_counters.clear();
 }
 
 void Profiler::reportToConsole()
@@ -105,7 +122,7 @@ void Profiler::reportToConsole()
         
     std::lock_guard<std::mutex> lock(m_profileMutex);
     
-    if (m_profiles.empty())
+    if (m_profiles.empty() && m_counters.empty())
         return;
 
     // Sort profiles by total time (descending)
@@ -163,6 +180,14 @@ void Profiler::reportToConsole()
     }
     
     std::cout << "* FPS calculated from average frame time" << std::endl;
+    
+    if (!m_counters.empty())
+    {
+        std::cout << std::left << std::setw(35) << "Counter" << std::right << std::setw(16) << "Value" << std::endl;
+        std::cout << std::string(51, '-') << std::endl;
+        for (const auto& [name, value] : m_counters)
+            std::cout << std::left << std::setw(35) << name.substr(0, 34) << std::right << std::setw(16) << value << std::endl;
+    }
     std::cout << std::endl;
 }
 
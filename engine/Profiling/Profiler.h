@@ -2,6 +2,8 @@
 // (Moved from Core to Profiling)
 #pragma once
 #include <chrono>
+#include <cstdint>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,6 +36,7 @@ public:
 
 private:
     std::unordered_map<std::string, ProfileData> m_profiles;
+    std::map<std::string, int64_t> m_counters;  // Latest value per counter, reported in name order
     std::chrono::high_resolution_clock::time_point m_lastReportTime;
     mutable std::mutex m_profileMutex;
     bool m_enabled = true;
@@ -62,6 +65,10 @@ public:
     // Get specific profile data
     const ProfileData* getProfileData(const std::string& name) const;
 
+    // Counters - a value (chunk counts, bytes, ...) reported as last set, kept across reports
+    void setCounter(const std::string& name, int64_t value);
+    int64_t getCounter(const std::string& name) const;  // 0 if never set
+
     // Clear all profile data
     void clearAll();
 
@@ -92,3 +99,4 @@ extern Profiler& g_profiler;
 // Convenient macros for profiling
 #define PROFILE_SCOPE(name) ProfileScope _prof_scope(name)
 #define PROFILE_FUNCTION() ProfileScope _prof_scope(__FUNCTION__)
+#define PROFILE_COUNTER(name, value) g_profiler.setCounter(name, static_cast<int64_t>(value))
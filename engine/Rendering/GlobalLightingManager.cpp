@@ -9,6 +9,7 @@
 #include "../Input/Camera.h"
 #include "../World/VoxelChunk.h"
 #include "../World/IslandChunkSystem.h"
+#include "../World/VoxelAccessor.h"
 #include "../Culling/FrustumCuller.h"
 #include "../Profiling/Profiler.h"
 
@@ -75,19 +76,22 @@ void GlobalLightingManager::recalcOcclusionNeighborhood(IslandChunkSystem* islan
     if (!islandSystem) return;
     PROFILE_SCOPE("GlobalLightingManager::recalcOcclusionNeighborhood");
 
-    FloatingIsland* island = islandSystem->getIsland(islandID);
-    if (!island) return;
+    // One read pin for the whole neighborhood - chunk lookups and the AO ray samples go through it
+    // (no other IslandChunkSystem call may lock while it is held)
+    VoxelAccessor voxels(*islandSystem, islandID);
+    if (!voxels.valid()) return;
+    const FloatingIsland* island = voxels.getIsland();
 
     // Iterate in a cube radius around the center chunk
     for (int dz = -radiusChunks; dz <= radiusChunks; ++dz) {
         for (int dy = -radiusChunks; dy <= radiusChunks; ++dy) {
             for (int dx = -radiusChunks; dx <= radiusChunks; ++dx) {
-                Vec3 cc(centerChunkCoord.x + dx, centerChunkCoord.y + dy, centerChunkCoord.z + dz);
-                VoxelChunk* chunk = islandSystem->getChunkFromIsland(islandID, cc);
+                ChunkCoord cc = ChunkCoord::fromVec3(centerChunkCoord) + ChunkCoord(dx, dy, dz);
+                VoxelChunk* chunk = voxels.chunkAt(cc);
                 if (!chunk) continue;
 
                 // Compute world pos of chunk origin
-                Vec3 chunkWorldPos = island->physicsCenter + FloatingIsland::chunkCoordToWorldPos(cc);
+                Vec3 chunkWorldPos = island->getPhysicsCenter() + FloatingIsland::chunkCoordToWorldPos(cc);
 
                 // Generate occlusion-only face lightmaps factoring neighbor chunks
                 ChunkLightMaps& lightMaps = chunk->getLightMaps();
@@ -103,12 +107,12 @@ void GlobalLightingManager::recalcOcclusionNeighborhood(IslandChunkSystem* islan
                 const int SAMPLE_STEP = 4; // 4x4 texel blocks
 
                 auto sampleSolidAtIslandPos = [&](const Vec3& islandPos) -> bool {
-                    // Query voxel value via island system; returns >0 if solid
-                    return islandSystem->getVoxelFromIsland(islandID, islandPos) != 0;
+                    // Query voxel value via the pinned accessor; returns >0 if solid
+                    return voxels.isSolid(ChunkCoord::fromVec3(islandPos));
                 };
 
                 auto worldToIsland = [&](const Vec3& world) -> Vec3 {
-                    return world - island->physicsCenter;
+                    return world - island->getPhysicsCenter();
                 };
 
                 // For each face, fill the lightmap using a shared, group-anchored sampling grid
@@ -238,7 +242,7 @@ void GlobalLightingManager::gatherVisibleChunks(const Camera& camera, IslandChun
             m_stats.chunksConsidered++;
             
             // Calculate world position for this chunk
-            Vec3 chunkWorldPos = island.physicsCenter + 
+            Vec3 chunkWorldPos = island.getPhysicsCenter() + 
                 FloatingIsland::chunkCoordToWorldPos(chunkCoord);
             
             // Frustum culling check - TEMPORARILY DISABLED FOR DEBUG
@@ -422,7 +426,7 @@ void GlobalLightingManager::gatherVisibleChunksEfficient(const Camera& camera, I
             m_stats.chunksConsidered++;
             
             // Calculate world position for this chunk
-            Vec3 chunkWorldPos = island.physicsCenter + 
+            Vec3 chunkWorldPos = island.getPhysicsCenter() + 
                 FloatingIsland::chunkCoordToWorldPos(chunkCoord);
             
             // Frustum culling check
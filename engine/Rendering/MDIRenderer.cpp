@@ -6,6 +6,7 @@
 #include "TextureManager.h"
 #include "../Profiling/Profiler.h"
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
 #include <iostream>
 #include <chrono>
 #include <cstring>
@@ -59,36 +60,10 @@ bool MDIRenderer::initialize(uint32_t maxChunks, uint32_t initialBufferChunks)
     glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
     glBufferData(GL_ARRAY_BUFFER, m_totalVertexCapacity * sizeof(Vertex), nullptr, GL_DYNAMIC_DRAW);
     
-    // Setup vertex attributes (MUST match Vertex struct in VoxelChunk.h)
-    // Vertex struct: x,y,z, nx,ny,nz, u,v, lu,lv, ao, faceIndex, blockType (13 floats total)
-    
-    // location 0: aPosition (x, y, z)
+    // Setup vertex attributes (MUST match the packed Vertex struct in VoxelChunk.h)
+    // location 0: aPacked (geometry, material) - two integer words, decoded in the vertex shaders
     glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(0 * sizeof(float)));
-    
-    // location 1: aTexCoord (u, v) - shader expects this at location 1
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(6 * sizeof(float)));
-    
-    // location 2: aNormal (nx, ny, nz) - shader expects this at location 2
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(3 * sizeof(float)));
-    
-    // location 3: aLightMapCoord (lu, lv)
-    glEnableVertexAttribArray(3);
-    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(8 * sizeof(float)));
-    
-    // location 4: aAmbientOcclusion (ao)
-    glEnableVertexAttribArray(4);
-    glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(10 * sizeof(float)));
-    
-    // location 5: aFaceIndex
-    glEnableVertexAttribArray(5);
-    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(11 * sizeof(float)));
-    
-    // location 6: aBlockType
-    glEnableVertexAttribArray(6);
-    glVertexAttribPointer(6, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(12 * sizeof(float)));
+    glVertexAttribIPointer(0, 2, GL_UNSIGNED_INT, sizeof(Vertex), (void*)0);
     
     // Create shared EBO
     glGenBuffers(1, &m_indexBuffer);
@@ -485,6 +460,28 @@ void MDIRenderer::updateChunkMesh(int chunkIndex, VoxelChunk* chunk)
     }
 }
 
+void MDIRenderer::releaseChunk(VoxelChunk* chunk)
+{
+    if (!chunk)
+        return;
+    
+    {
+        std::lock_guard<std::mutex> lock(m_pendingMutex);
+        m_pendingRegistrations.erase(std::remove_if(m_pendingRegistrations.begin(), m_pendingRegistrations.end(),
+                                                    [chunk](const PendingRegistration& pending) { return pending.chunk == chunk; }),
+                                     m_pendingRegistrations.end());
+        m_pendingMeshUpdates.erase(std::remove_if(m_pendingMeshUpdates.begin(), m_pendingMeshUpdates.end(),
+                                                  [chunk](const PendingMeshUpdate& pending) { return pending.chunk == chunk; }),
+                                   m_pendingMeshUpdates.end());
+    }
+    
+    if (chunk->getMDIIndex() >= 0)
+    {
+        unregisterChunk(chunk->getMDIIndex());
+        chunk->setMDIIndex(-1);
+    }
+}
+
 void MDIRenderer::unregisterChunk(int chunkIndex)
 {
     if (chunkIndex < 0 || chunkIndex >= static_cast<int>(m_chunkData.size()))
@@ -787,7 +784,7 @@ bool MDIRenderer::initDepthShader()
     // Depth-only vertex shader with SSBO support for MDI
     const char* vs = R"(
         #version 460 core
-        layout(location = 0) in vec3 aPosition;
+        layout(location = 0) in uvec2 aPacked;  // Packed Vertex - only the position bits matter here
         
         uniform mat4 uLightVP;
         
@@ -798,7 +795,8 @@ bool MDIRenderer::initDepthShader()
         
         void main() {
             mat4 model = transforms[gl_BaseInstance];
-            gl_Position = uLightVP * model * vec4(aPosition, 1.0);
+            vec3 position = vec3(aPacked.x & 31u, (aPacked.x >> 5) & 31u, (aPacked.x >> 10) & 31u);
+            gl_Position = uLightVP * model * vec4(position, 1.0);
         }
     )";
     
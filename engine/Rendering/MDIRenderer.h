@@ -121,6 +121,11 @@ public:
      */
     void unregisterChunk(int chunkIndex);
     
+    /**
+     * Forget a chunk that is about to be destroyed: its slot and any update still queued for it
+     */
+    void releaseChunk(VoxelChunk* chunk);
+    
     // ================================
     // RENDERING
     // ================================
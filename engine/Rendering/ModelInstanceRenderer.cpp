@@ -594,6 +594,20 @@ void ModelInstanceRenderer::updateModelMatrix(uint8_t blockID, VoxelChunk* chunk
     ensureChunkInstancesUploaded(blockID, chunk);
 }
 
+void ModelInstanceRenderer::removeChunk(VoxelChunk* chunk) {
+    for (auto it = m_chunkInstances.begin(); it != m_chunkInstances.end();) {
+        if (it->first.first != chunk) {
+            ++it;
+            continue;
+        }
+        if (it->second.instanceVBO) glDeleteBuffers(1, &it->second.instanceVBO);
+        if (!it->second.vaos.empty()) {
+            glDeleteVertexArrays(static_cast<GLsizei>(it->second.vaos.size()), it->second.vaos.data());
+        }
+        it = m_chunkInstances.erase(it);
+    }
+}
+
 void ModelInstanceRenderer::renderAll(const glm::mat4& view, const glm::mat4& proj) {
     // Update lighting once for all models
     updateLightingIfNeeded();
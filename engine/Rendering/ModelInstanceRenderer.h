@@ -76,6 +76,9 @@ public:
     // Update model matrix without rendering (stores pre-calculated chunk transform)
     void updateModelMatrix(uint8_t blockID, VoxelChunk* chunk, const glm::mat4& chunkTransform);
 
+    // Free the instance buffers of a chunk that is about to be destroyed
+    void removeChunk(VoxelChunk* chunk);
+
 private:
     bool ensureChunkInstancesUploaded(uint8_t blockID, VoxelChunk* chunk);
     bool ensureShaders();
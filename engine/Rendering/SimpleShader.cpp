@@ -9,13 +9,15 @@
 static const char* VERTEX_SHADER_SOURCE = R"(
 #version 460 core
 
-layout (location = 0) in vec3 aPosition;
-layout (location = 1) in vec2 aTexCoord;
-layout (location = 2) in vec3 aNormal;
-layout (location = 3) in vec2 aLightMapCoord;
-layout (location = 4) in float aAmbientOcclusion;
-layout (location = 5) in float aFaceIndex;
-layout (location = 6) in float aBlockType;
+// Packed chunk vertex (Vertex in VoxelChunk.h):
+//   x = position 3x5 bits | texcoord 2x5 bits | face 3 bits | AO level 3 bits
+//   y = block type (bits 0-7)
+layout (location = 0) in uvec2 aPacked;
+
+const vec3 FACE_NORMALS[6] = vec3[6](
+    vec3(0.0, -1.0, 0.0), vec3(0.0, 1.0, 0.0),   // -Y, +Y
+    vec3(0.0, 0.0, -1.0), vec3(0.0, 0.0, 1.0),   // -Z, +Z
+    vec3(-1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0));  // -X, +X
 
 // Retain UBO signature for compatibility, though not used for lighting
 layout (std140, binding = 0) uniform ChunkLightingData {
@@ -59,12 +61,16 @@ void main()
         finalTransform = uModel;
     }
 
-    vec4 world = finalTransform * vec4(aPosition, 1.0);
+    uint geometry = aPacked.x;
+    vec3 position = vec3(geometry & 31u, (geometry >> 5) & 31u, (geometry >> 10) & 31u);
+    uint face = min((geometry >> 25) & 7u, 5u);
+
+    vec4 world = finalTransform * vec4(position, 1.0);
     gl_Position = uProjection * uView * world;
-    TexCoord = aTexCoord;
-    Normal = aNormal;
+    TexCoord = vec2((geometry >> 15) & 31u, (geometry >> 20) & 31u);
+    Normal = FACE_NORMALS[face];
     WorldPos = world.xyz;
-    BlockType = aBlockType;
+    BlockType = float(aPacked.y & 255u);
     LightSpacePos = uLightVP * world;
     // View-space depth (positive distance)
     ViewZ = -(uView * world).z;
@@ -12,9 +12,44 @@ void BlockTypeRegistry::registerBlockType(uint8_t id, const std::string& name, B
     }
     
     m_blockTypes[id] = BlockTypeInfo(id, name, renderType, assetPath, properties);
+    rebuildPropertyTables();
     std::cout << "Registered block type: " << name << " (ID: " << (int)id << ")" << std::endl;
 }
 
+void BlockTypeRegistry::rebuildPropertyTables() {
+    m_tables = BlockPropertyTables();
+    
+    // Unregistered non-air IDs stay plain solid cubes (meshed, colliding, opaque), as voxels always
+    // were before they had a registered type - unknown IDs from a newer save or peer stay visible
+    m_tables.meshed.set();
+    m_tables.solid.set();
+    m_tables.opaque.set();
+    m_tables.meshed[BlockID::AIR] = false;
+    m_tables.solid[BlockID::AIR] = false;
+    m_tables.opaque[BlockID::AIR] = false;
+    
+    for (const BlockTypeInfo& info : m_blockTypes) {
+        if (info.name.empty() || info.id == BlockID::AIR) {
+            continue;  // Unregistered slot or air - defaults above
+        }
+        
+        const uint8_t id = info.id;
+        const BlockProperties& props = info.properties;
+        const bool isObj = info.renderType == BlockRenderType::OBJ;
+        
+        m_tables.meshed[id] = !isObj;
+        m_tables.solid[id] = props.isSolid;
+        m_tables.opaque[id] = !isObj && !props.isTransparent;
+        m_tables.obj[id] = isObj;
+        m_tables.liquid[id] = props.isLiquid;
+        m_tables.emissive[id] = props.emitsLight;
+        m_tables.lightLevel[id] = props.emitsLight ? props.lightLevel : 0;
+        if (isObj) {
+            m_tables.objIDs.push_back(id);
+        }
+    }
+}
+
 const BlockTypeInfo* BlockTypeRegistry::getBlockType(uint8_t id) const {
     if (id < m_blockTypes.size() && !m_blockTypes[id].name.empty()) {
         return &m_blockTypes[id];
@@ -3,6 +3,8 @@
 
 #include <string>
 #include <vector>
+#include <array>
+#include <bitset>
 #include <cstdint>
 #include "BlockProperties.h"
 
@@ -52,6 +54,20 @@ struct BlockTypeInfo {
         : id(blockID), name(blockName), renderType(type), assetPath(asset), properties(props) {}
 };
 
+// Dense per-ID lookup tables derived from the registry (rebuilt on every registration).
+// Hot loops index these by block ID instead of chasing BlockTypeInfo pointers.
+// Unregistered non-air IDs read as plain solid cubes (meshed, solid, opaque), air has every flag clear.
+struct BlockPropertyTables {
+    std::bitset<256> meshed;    // Occupies its cell in the voxel mesh (not air, not OBJ) - culling, AO
+    std::bitset<256> solid;     // Has collision (BlockProperties::isSolid)
+    std::bitset<256> opaque;    // Meshed and not transparent - hides faces, blocks light
+    std::bitset<256> obj;       // Rendered as an instanced model (BlockRenderType::OBJ)
+    std::bitset<256> liquid;
+    std::bitset<256> emissive;
+    std::array<uint8_t, 256> lightLevel{};
+    std::vector<uint8_t> objIDs;  // IDs with obj set, ascending
+};
+
 class BlockTypeRegistry {
 public:
     static BlockTypeRegistry& getInstance() {
@@ -75,9 +91,22 @@ public:
     // Get all registered block types
     const std::vector<BlockTypeInfo>& getAllBlockTypes() const { return m_blockTypes; }
 
+    // Flat property lookups (no bounds checks needed - tables cover every uint8_t ID)
+    const BlockPropertyTables& getPropertyTables() const { return m_tables; }
+    bool isMeshed(uint8_t id) const { return m_tables.meshed[id]; }
+    bool isSolid(uint8_t id) const { return m_tables.solid[id]; }
+    bool isOpaque(uint8_t id) const { return m_tables.opaque[id]; }
+    bool isOBJ(uint8_t id) const { return m_tables.obj[id]; }
+    bool isLiquid(uint8_t id) const { return m_tables.liquid[id]; }
+    bool isEmissive(uint8_t id) const { return m_tables.emissive[id]; }
+    uint8_t getLightLevel(uint8_t id) const { return m_tables.lightLevel[id]; }
+
 private:
     BlockTypeRegistry();
     void initializeDefaultBlocks();
+    void rebuildPropertyTables();
+    
+    BlockPropertyTables m_tables;
     
     std::vector<BlockTypeInfo> m_blockTypes;  // Simple array indexed by block ID
     static const std::string UNKNOWN_BLOCK_NAME;
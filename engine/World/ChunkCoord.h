@@ -0,0 +1,276 @@
+// ChunkCoord.h - Integer chunk coordinates and flat hash containers keyed on them
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../Math/Vec3.h"
+
+// Integer grid coordinate (chunk coords; integral island-relative voxel positions use it too).
+// Packs into one 64-bit key, 21 bits per axis: +-1M cells, far beyond any island.
+struct ChunkCoord
+{
+    int32_t x = 0;
+    int32_t y = 0;
+    int32_t z = 0;
+
+    static constexpr int KEY_BITS = 21;
+    static constexpr uint64_t KEY_MASK = (uint64_t(1) << KEY_BITS) - 1;
+
+    constexpr ChunkCoord() = default;
+    constexpr ChunkCoord(int32_t cx, int32_t cy, int32_t cz) : x(cx), y(cy), z(cz) {}
+
+    // Floors each component - exact for the integral Vec3s the old float-keyed maps used
+    static ChunkCoord fromVec3(const Vec3& v)
+    {
+        return ChunkCoord(static_cast<int32_t>(std::floor(v.x)), static_cast<int32_t>(std::floor(v.y)),
+                          static_cast<int32_t>(std::floor(v.z)));
+    }
+    Vec3 toVec3() const { return Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)); }
+
+    uint64_t key() const
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(x)) & KEY_MASK) |
+               ((static_cast<uint64_t>(static_cast<uint32_t>(y)) & KEY_MASK) << KEY_BITS) |
+               ((static_cast<uint64_t>(static_cast<uint32_t>(z)) & KEY_MASK) << (2 * KEY_BITS));
+    }
+
+    ChunkCoord operator+(const ChunkCoord& o) const { return ChunkCoord(x + o.x, y + o.y, z + o.z); }
+    ChunkCoord operator-(const ChunkCoord& o) const { return ChunkCoord(x - o.x, y - o.y, z - o.z); }
+    bool operator==(const ChunkCoord& o) const { return x == o.x && y == o.y && z == o.z; }
+    bool operator!=(const ChunkCoord& o) const { return !(*this == o); }
+
+    // Floor division for grid cell sizes (negative coords round toward -inf)
+    static int32_t floorDiv(int32_t v, int32_t size) { return (v >= 0 ? v : v - (size - 1)) / size; }
+};
+
+// Open-addressing hash map from ChunkCoord to T: linear probing over a power-of-two table,
+// backward-shift erase (no tombstones). One cache line per typical lookup instead of a tree walk.
+// Iteration order is unspecified. Inserting may rehash: it invalidates iterators and references
+// to values (store unique_ptrs when stable addresses are needed); erase invalidates iterators.
+template <typename T>
+class ChunkCoordMap
+{
+   public:
+    using value_type = std::pair<ChunkCoord, T>;
+
+    template <bool Const>
+    class Iterator
+    {
+       public:
+        using Owner = typename std::conditional<Const, const ChunkCoordMap, ChunkCoordMap>::type;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = ChunkCoordMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = typename std::conditional<Const, const value_type&, value_type&>::type;
+        using pointer = typename std::conditional<Const, const value_type*, value_type*>::type;
+
+        Iterator() = default;
+        Iterator(Owner* map, size_t slot) : m_map(map), m_slot(slot) { skipEmpty(); }
+        template <bool WasConst, typename = typename std::enable_if<Const && !WasConst>::type>
+        Iterator(const Iterator<WasConst>& other) : m_map(other.m_map), m_slot(other.m_slot) {}
+
+        reference operator*() const { return m_map->m_slots[m_slot]; }
+        pointer operator->() const { return &m_map->m_slots[m_slot]; }
+        Iterator& operator++()
+        {
+            ++m_slot;
+            skipEmpty();
+            return *this;
+        }
+        bool operator==(const Iterator& o) const { return m_slot == o.m_slot; }
+        bool operator!=(const Iterator& o) const { return m_slot != o.m_slot; }
+
+       private:
+        friend class ChunkCoordMap;
+        template <bool>
+        friend class Iterator;
+        void skipEmpty()
+        {
+            while (m_slot < m_map->m_used.size() && !m_map->m_used[m_slot])
+                ++m_slot;
+        }
+        Owner* m_map = nullptr;
+        size_t m_slot = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_used.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_used.size()); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    iterator find(const ChunkCoord& coord) { return iterator(this, findSlot(coord)); }
+    const_iterator find(const ChunkCoord& coord) const { return const_iterator(this, findSlot(coord)); }
+    bool contains(const ChunkCoord& coord) const { return findSlot(coord) != m_used.size(); }
+
+    // Default-constructs the value when absent (like std::map)
+    T& operator[](const ChunkCoord& coord) { return insertSlot(coord).first->second; }
+
+    // Returns {slot, inserted}
+    std::pair<iterator, bool> emplace(const ChunkCoord& coord, T value)
+    {
+        auto result = insertSlot(coord);
+        if (result.second)
+            result.first->second = std::move(value);
+        return result;
+    }
+
+    void erase(iterator it) { eraseSlot(it.m_slot); }
+    size_t erase(const ChunkCoord& coord)
+    {
+        const size_t slot = findSlot(coord);
+        if (slot == m_used.size())
+            return 0;
+        eraseSlot(slot);
+        return 1;
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_used.clear();
+        m_size = 0;
+    }
+
+    void reserve(size_t count)
+    {
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * MAX_LOAD_NUM < count * MAX_LOAD_DEN)
+            capacity *= 2;
+        if (capacity > m_used.size())
+            rehash(capacity);
+    }
+
+   private:
+    static constexpr size_t MIN_CAPACITY = 16;
+    static constexpr size_t MAX_LOAD_NUM = 3;  // Grow past 3/4 full
+    static constexpr size_t MAX_LOAD_DEN = 4;
+
+    static size_t hashKey(uint64_t key)
+    {
+        // 64-bit finalizer (MurmurHash3 fmix64) - neighboring coords land far apart
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        key *= 0xc4ceb9fe1a85ec53ULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+    size_t mask() const { return m_used.size() - 1; }
+
+    // Slot index, or m_used.size() when absent
+    size_t findSlot(const ChunkCoord& coord) const
+    {
+        if (m_size == 0)
+            return m_used.size();
+        for (size_t slot = hashKey(coord.key()) & mask();; slot = (slot + 1) & mask())
+        {
+            if (!m_used[slot])
+                return m_used.size();
+            if (m_slots[slot].first == coord)
+                return slot;
+        }
+    }
+
+    std::pair<iterator, bool> insertSlot(const ChunkCoord& coord)
+    {
+        const size_t existing = findSlot(coord);
+        if (existing != m_used.size())
+            return {iterator(this, existing), false};
+
+        if ((m_size + 1) * MAX_LOAD_DEN > m_used.size() * MAX_LOAD_NUM)
+            rehash(m_used.empty() ? MIN_CAPACITY : m_used.size() * 2);
+
+        size_t slot = hashKey(coord.key()) & mask();
+        while (m_used[slot])
+            slot = (slot + 1) & mask();
+
+        m_used[slot] = 1;
+        m_slots[slot].first = coord;
+        m_slots[slot].second = T();
+        ++m_size;
+        return {iterator(this, slot), true};
+    }
+
+    void eraseSlot(size_t slot)
+    {
+        // Backward-shift: pull later members of the probe run into the hole so lookups never need tombstones
+        m_slots[slot].second = T();
+        m_used[slot] = 0;
+        --m_size;
+
+        size_t hole = slot;
+        for (size_t next = (slot + 1) & mask(); m_used[next]; next = (next + 1) & mask())
+        {
+            const size_t home = hashKey(m_slots[next].first.key()) & mask();
+            // Move only if the hole lies on the cyclic path home -> next
+            const bool holeBetween = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+            if (holeBetween)
+            {
+                m_slots[hole] = std::move(m_slots[next]);
+                m_slots[next].second = T();
+                m_used[hole] = 1;
+                m_used[next] = 0;
+                hole = next;
+            }
+        }
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<value_type> oldSlots(capacity);
+        std::vector<uint8_t> oldUsed(capacity, 0);
+        oldSlots.swap(m_slots);
+        oldUsed.swap(m_used);
+
+        for (size_t i = 0; i < oldUsed.size(); ++i)
+        {
+            if (!oldUsed[i])
+                continue;
+            size_t slot = hashKey(oldSlots[i].first.key()) & mask();
+            while (m_used[slot])
+                slot = (slot + 1) & mask();
+            m_slots[slot] = std::move(oldSlots[i]);
+            m_used[slot] = 1;
+        }
+    }
+
+    std::vector<value_type> m_slots;
+    std::vector<uint8_t> m_used;
+    size_t m_size = 0;
+};
+
+// Flat set of integer coordinates (flood-fill visited sets and the like)
+class ChunkCoordSet
+{
+   public:
+    // True when newly added
+    bool insert(const ChunkCoord& coord) { return m_map.emplace(coord, 1).second; }
+    bool contains(const ChunkCoord& coord) const { return m_map.contains(coord); }
+    size_t erase(const ChunkCoord& coord) { return m_map.erase(coord); }
+    size_t size() const { return m_map.size(); }
+    bool empty() const { return m_map.empty(); }
+    void reserve(size_t count) { m_map.reserve(count); }
+    void clear() { m_map.clear(); }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) const
+    {
+        for (const auto& entry : m_map)
+            fn(entry.first);
+    }
+
+   private:
+    ChunkCoordMap<uint8_t> m_map;
+};
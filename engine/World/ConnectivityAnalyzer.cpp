@@ -1,205 +1,273 @@
 // ConnectivityAnalyzer.cpp - Implementation of connectivity detection
 #include "ConnectivityAnalyzer.h"
 #include "IslandChunkSystem.h"
+#include "VoxelAccessor.h"
 #include "VoxelChunk.h"
-#include <iostream>
+#include "../Core/JobSystem.h"
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <iostream>
 
-std::vector<ConnectedGroup> ConnectivityAnalyzer::analyzeIsland(const FloatingIsland* island)
+namespace
 {
-    if (!island) return {};
+constexpr int CHUNK_SIZE = VoxelChunk::SIZE;
+constexpr int CHUNK_VOLUME = VoxelChunk::VOLUME;
+constexpr int AXIS_STRIDE[3] = {1, CHUNK_SIZE, CHUNK_SIZE * CHUNK_SIZE};
+
+// Union-find over global labels - the root of a set is its smallest label
+uint32_t findRoot(std::vector<uint32_t>& parent, uint32_t label)
+{
+    while (parent[label] != label)
+    {
+        parent[label] = parent[parent[label]];  // Path halving
+        label = parent[label];
+    }
+    return label;
+}
+
+void unite(std::vector<uint32_t>& parent, uint32_t a, uint32_t b)
+{
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a < b)
+        parent[b] = a;
+    else if (b < a)
+        parent[a] = b;
+}
+}  // namespace
+
+struct ConnectivityAnalyzer::IslandLabels
+{
+    std::vector<ChunkCoord> chunkCoords;   // Hot chunks, in the island's iteration order
+    std::vector<VoxelChunk*> chunks;
+    ChunkCoordMap<uint32_t> chunkIndex;    // Chunk coord -> index into the vectors above
+    std::vector<uint16_t> voxelLabels;     // CHUNK_VOLUME per chunk: 0 = air, else the chunk-local label
+    std::vector<uint32_t> firstLabel;      // Global label of each chunk's local label 1 (+ total at the end)
+    std::vector<uint32_t> component;       // Global label -> connected component, numbered in label order
+    uint32_t componentCount = 0;
+    
+    const uint16_t* chunkLabels(size_t chunkIndex) const { return voxelLabels.data() + chunkIndex * CHUNK_VOLUME; }
+    uint32_t globalLabel(size_t chunkIndex, uint16_t localLabel) const { return firstLabel[chunkIndex] + localLabel - 1; }
+};
+
+void ConnectivityAnalyzer::labelIsland(const FloatingIsland& island, IslandLabels& out)
+{
+    out.chunkCoords.clear();
+    out.chunks.clear();
+    out.chunkIndex.clear();
+    out.chunkCoords.reserve(island.chunks.size());
+    out.chunks.reserve(island.chunks.size());
+    out.chunkIndex.reserve(island.chunks.size());
+    for (const auto& [chunkCoord, chunk] : island.chunks)
+    {
+        if (!chunk) continue;
+        out.chunkIndex.emplace(chunkCoord, static_cast<uint32_t>(out.chunks.size()));
+        out.chunkCoords.push_back(chunkCoord);
+        out.chunks.push_back(chunk.get());
+    }
+    const size_t chunkCount = out.chunks.size();
+    
+    // Per-chunk labelling is independent - one job range per few chunks
+    out.voxelLabels.resize(chunkCount * CHUNK_VOLUME);
+    std::vector<uint16_t> labelCounts(chunkCount);
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
+    {
+        uint8_t voxels[CHUNK_VOLUME];
+        out.chunks[i]->copyRawVoxelData(voxels);
+        labelCounts[i] = IslandConnectivity::labelChunk(voxels, out.voxelLabels.data() + i * CHUNK_VOLUME);
+    });
+    
+    out.firstLabel.resize(chunkCount + 1);
+    uint32_t labelTotal = 0;
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        out.firstLabel[i] = labelTotal;
+        labelTotal += labelCounts[i];
+    }
+    out.firstLabel[chunkCount] = labelTotal;
     
-    std::vector<ConnectedGroup> groups;
-    std::unordered_set<Vec3> visited;
+    // Merge labels across shared faces, each face visited once from its lower chunk
+    std::vector<uint32_t> parent(labelTotal);
+    for (uint32_t label = 0; label < labelTotal; ++label)
+        parent[label] = label;
     
-    // Iterate through all chunks and their voxels to find starting points
-    for (const auto& [chunkCoord, chunk] : island->chunks)
+    const ChunkCoord axisStep[3] = {ChunkCoord(1, 0, 0), ChunkCoord(0, 1, 0), ChunkCoord(0, 0, 1)};
+    for (size_t i = 0; i < chunkCount; ++i)
     {
-        if (!chunk) continue;
-        
-        // Check each voxel in the chunk
-        Vec3 chunkWorldOffset = FloatingIsland::chunkCoordToWorldPos(chunkCoord);
-        
-        for (int x = 0; x < VoxelChunk::SIZE; x++)
+        for (int axis = 0; axis < 3; ++axis)
         {
-            for (int y = 0; y < VoxelChunk::SIZE; y++)
+            auto neighborIt = out.chunkIndex.find(out.chunkCoords[i] + axisStep[axis]);
+            if (neighborIt == out.chunkIndex.end()) continue;
+            const size_t j = neighborIt->second;
+            
+            const uint16_t* lower = out.chunkLabels(i) + (CHUNK_SIZE - 1) * AXIS_STRIDE[axis];
+            const uint16_t* upper = out.chunkLabels(j);
+            const int strideU = AXIS_STRIDE[(axis + 1) % 3];
+            const int strideV = AXIS_STRIDE[(axis + 2) % 3];
+            uint16_t lastLower = 0;
+            uint16_t lastUpper = 0;
+            for (int v = 0; v < CHUNK_SIZE; ++v)
             {
-                for (int z = 0; z < VoxelChunk::SIZE; z++)
+                for (int u = 0; u < CHUNK_SIZE; ++u)
                 {
-                    uint8_t voxelType = chunk->getVoxel(x, y, z);
-                    if (voxelType == 0) continue;  // Skip air
-                    
-                    // Convert to island-relative position
-                    Vec3 islandRelativePos = chunkWorldOffset + Vec3(x, y, z);
-                    
-                    // If not visited, start a new flood-fill
-                    if (visited.find(islandRelativePos) == visited.end())
-                    {
-                        ConnectedGroup group = floodFill(island, islandRelativePos, visited);
-                        if (group.voxelCount > 0)
-                        {
-                            groups.push_back(group);
-                        }
-                    }
+                    const int faceIndex = u * strideU + v * strideV;
+                    const uint16_t a = lower[faceIndex];
+                    const uint16_t b = upper[faceIndex];
+                    if (a == 0 || b == 0 || (a == lastLower && b == lastUpper)) continue;
+                    unite(parent, out.globalLabel(i, a), out.globalLabel(j, b));
+                    lastLower = a;
+                    lastUpper = b;
                 }
             }
         }
     }
     
-    return groups;
+    // Roots are the smallest label of their set, so they're numbered before any label that joins them
+    out.component.resize(labelTotal);
+    out.componentCount = 0;
+    for (uint32_t label = 0; label < labelTotal; ++label)
+    {
+        const uint32_t root = findRoot(parent, label);
+        out.component[label] = (root == label) ? out.componentCount++ : out.component[root];
+    }
 }
 
-int ConnectivityAnalyzer::cleanupSatellites(FloatingIsland* island, const Vec3& mainIslandAnchor)
+std::vector<ConnectedGroup> ConnectivityAnalyzer::analyzeIsland(const FloatingIsland* island)
 {
-    if (!island) return 0;
-    
-    auto totalStart = std::chrono::high_resolution_clock::now();
-    
-    // **FAST PATH**: Single flood-fill from anchor point to mark main island
-    std::unordered_set<Vec3> mainIslandVoxels;
-    
-    auto anchorCheckStart = std::chrono::high_resolution_clock::now();
+    if (!island) return {};
     
-    long long anchorCheckDuration = 0;
-    long long findSolidDuration = 0;
-    long long floodFillDuration = 0;
+    IslandLabels labels;
+    labelIsland(*island, labels);
+    const size_t chunkCount = labels.chunks.size();
+    const size_t labelTotal = labels.component.size();
     
-    // Check if anchor point is solid
-    if (!isSolidVoxel(island, mainIslandAnchor))
+    // Voxel count and coordinate sum per label - every label belongs to one chunk, so chunks don't race
+    struct LabelStats
     {
-        auto anchorCheckEnd = std::chrono::high_resolution_clock::now();
-        anchorCheckDuration = std::chrono::duration_cast<std::chrono::milliseconds>(anchorCheckEnd - anchorCheckStart).count();
-        
-        auto findSolidStart = std::chrono::high_resolution_clock::now();
-        
-        // Anchor is air - find nearest solid voxel (fallback)
-        bool foundSolid = false;
-        Vec3 solidPos;
-        
-        for (const auto& [chunkCoord, chunk] : island->chunks)
-        {
-            if (!chunk || foundSolid) break;
-            
-            Vec3 chunkWorldOffset = FloatingIsland::chunkCoordToWorldPos(chunkCoord);
-            for (int x = 0; x < VoxelChunk::SIZE && !foundSolid; x++)
-            {
-                for (int y = 0; y < VoxelChunk::SIZE && !foundSolid; y++)
-                {
-                    for (int z = 0; z < VoxelChunk::SIZE && !foundSolid; z++)
-                    {
-                        if (chunk->getVoxel(x, y, z) != 0)
-                        {
-                            solidPos = chunkWorldOffset + Vec3(x, y, z);
-                            foundSolid = true;
-                        }
-                    }
-                }
-            }
-        }
-        
-        if (!foundSolid)
+        uint32_t voxelCount = 0;
+        uint32_t writeOffset = 0;  // Next slot in its group's voxelPositions
+        double sum[3] = {0.0, 0.0, 0.0};
+    };
+    std::vector<LabelStats> stats(labelTotal);
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
+    {
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(labels.chunkCoords[i]);
+        const uint16_t* chunkLabels = labels.chunkLabels(i);
+        for (int index = 0; index < CHUNK_VOLUME; ++index)
         {
-            // No solid voxels found - nothing to clean up
-            return 0;
+            if (chunkLabels[index] == 0) continue;
+            LabelStats& label = stats[labels.globalLabel(i, chunkLabels[index])];
+            label.voxelCount++;
+            label.sum[0] += origin.x + (index & 15);
+            label.sum[1] += origin.y + ((index >> 4) & 15);
+            label.sum[2] += origin.z + (index >> 8);
         }
-        
-        auto findSolidEnd = std::chrono::high_resolution_clock::now();
-        findSolidDuration = std::chrono::duration_cast<std::chrono::milliseconds>(findSolidEnd - findSolidStart).count();
-        
-        auto floodFillStart = std::chrono::high_resolution_clock::now();
-        
-        // Start flood-fill from first solid voxel found
-        std::queue<Vec3> queue;
-        queue.push(solidPos);
-        mainIslandVoxels.insert(solidPos);
-        
-        // Flood-fill to mark all connected voxels
-        while (!queue.empty())
+    });
+    
+    // Fold labels into groups; each label gets a contiguous slice of its group's positions
+    std::vector<ConnectedGroup> groups(labels.componentCount);
+    std::vector<double> groupSums(labels.componentCount * 3, 0.0);
+    for (ConnectedGroup& group : groups)
+        group.voxelCount = 0;
+    for (size_t label = 0; label < labelTotal; ++label)
+    {
+        const uint32_t componentIndex = labels.component[label];
+        ConnectedGroup& group = groups[componentIndex];
+        stats[label].writeOffset = static_cast<uint32_t>(group.voxelCount);
+        group.voxelCount += stats[label].voxelCount;
+        for (int axis = 0; axis < 3; ++axis)
+            groupSums[componentIndex * 3 + axis] += stats[label].sum[axis];
+    }
+    for (size_t componentIndex = 0; componentIndex < groups.size(); ++componentIndex)
+    {
+        ConnectedGroup& group = groups[componentIndex];
+        group.voxelPositions.resize(group.voxelCount);
+        const double invCount = 1.0 / static_cast<double>(group.voxelCount);
+        group.centerOfMass = Vec3(static_cast<float>(groupSums[componentIndex * 3 + 0] * invCount),
+                                  static_cast<float>(groupSums[componentIndex * 3 + 1] * invCount),
+                                  static_cast<float>(groupSums[componentIndex * 3 + 2] * invCount));
+    }
+    
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
+    {
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(labels.chunkCoords[i]);
+        const uint16_t* chunkLabels = labels.chunkLabels(i);
+        for (int index = 0; index < CHUNK_VOLUME; ++index)
         {
-            Vec3 current = queue.front();
-            queue.pop();
-            
-            for (const Vec3& neighbor : getNeighbors(current))
-            {
-                if (mainIslandVoxels.find(neighbor) != mainIslandVoxels.end()) continue;
-                if (!isSolidVoxel(island, neighbor)) continue;
-                
-                mainIslandVoxels.insert(neighbor);
-                queue.push(neighbor);
-            }
+            if (chunkLabels[index] == 0) continue;
+            const uint32_t label = labels.globalLabel(i, chunkLabels[index]);
+            groups[labels.component[label]].voxelPositions[stats[label].writeOffset++] =
+                (origin + ChunkCoord(index & 15, (index >> 4) & 15, index >> 8)).toVec3();
         }
-        
-        auto floodFillEnd = std::chrono::high_resolution_clock::now();
-        floodFillDuration = std::chrono::duration_cast<std::chrono::milliseconds>(floodFillEnd - floodFillStart).count();
-        
-        std::cout << "   ├─ Anchor Check: " << anchorCheckDuration << "ms (anchor was air)" << std::endl;
-        std::cout << "   ├─ Find Solid: " << findSolidDuration << "ms" << std::endl;
-        std::cout << "   └─ Flood Fill: " << floodFillDuration << "ms (" << mainIslandVoxels.size() << " voxels marked)" << std::endl;
+    });
+    
+    return groups;
+}
+
+int ConnectivityAnalyzer::cleanupSatellites(FloatingIsland* island, const Vec3& mainIslandAnchor)
+{
+    if (!island) return 0;
+    
+    auto labelStart = std::chrono::high_resolution_clock::now();
+    
+    IslandLabels labels;
+    labelIsland(*island, labels);
+    if (labels.componentCount == 0)
+    {
+        // No solid voxels found - nothing to clean up
+        return 0;
     }
-    else
+    
+    // Keep the anchor's component; if the anchor is air, the first solid voxel's (component 0)
+    uint32_t keepComponent = 0;
+    bool anchorSolid = false;
+    const ChunkCoord anchor = ChunkCoord::fromVec3(mainIslandAnchor);
+    const ChunkCoord anchorChunk = FloatingIsland::voxelToChunkCoord(anchor);
+    auto anchorIt = labels.chunkIndex.find(anchorChunk);
+    if (anchorIt != labels.chunkIndex.end())
     {
-        auto anchorCheckEnd = std::chrono::high_resolution_clock::now();
-        anchorCheckDuration = std::chrono::duration_cast<std::chrono::milliseconds>(anchorCheckEnd - anchorCheckStart).count();
-        
-        auto floodFillStart = std::chrono::high_resolution_clock::now();
-        
-        // Anchor is solid - flood-fill from anchor point
-        std::queue<Vec3> queue;
-        queue.push(mainIslandAnchor);
-        mainIslandVoxels.insert(mainIslandAnchor);
-        
-        while (!queue.empty())
+        const ChunkCoord local = anchor - FloatingIsland::chunkCoordToVoxel(anchorChunk);
+        const uint16_t localLabel = labels.chunkLabels(anchorIt->second)[local.x + local.y * AXIS_STRIDE[1] + local.z * AXIS_STRIDE[2]];
+        if (localLabel != 0)
         {
-            Vec3 current = queue.front();
-            queue.pop();
-            
-            for (const Vec3& neighbor : getNeighbors(current))
-            {
-                if (mainIslandVoxels.find(neighbor) != mainIslandVoxels.end()) continue;
-                if (!isSolidVoxel(island, neighbor)) continue;
-                
-                mainIslandVoxels.insert(neighbor);
-                queue.push(neighbor);
-            }
+            keepComponent = labels.component[labels.globalLabel(anchorIt->second, localLabel)];
+            anchorSolid = true;
         }
-        
-        auto floodFillEnd = std::chrono::high_resolution_clock::now();
-        floodFillDuration = std::chrono::duration_cast<std::chrono::milliseconds>(floodFillEnd - floodFillStart).count();
-        
-        std::cout << "   ├─ Anchor Check: " << anchorCheckDuration << "ms (anchor was solid)" << std::endl;
-        std::cout << "   └─ Flood Fill: " << floodFillDuration << "ms (" << mainIslandVoxels.size() << " voxels marked)" << std::endl;
     }
     
+    auto labelEnd = std::chrono::high_resolution_clock::now();
+    auto labelDuration = std::chrono::duration_cast<std::chrono::milliseconds>(labelEnd - labelStart).count();
+    
+    std::cout << "   ├─ Labelling: " << labelDuration << "ms (" << labels.chunks.size() << " chunks, "
+              << labels.componentCount << " components, anchor was " << (anchorSolid ? "solid" : "air") << ")" << std::endl;
+    
     auto deletionStart = std::chrono::high_resolution_clock::now();
     
-    // Delete everything NOT in main island
-    int voxelsRemoved = 0;
-    for (auto& [chunkCoord, chunk] : island->chunks)
+    // Delete everything NOT in the main component - chunks are disjoint, so clear them in parallel
+    std::atomic<int> voxelsRemoved{0};
+    g_jobSystem.parallelFor(labels.chunks.size(), [&](size_t i)
     {
-        if (!chunk) continue;
-        
-        Vec3 chunkWorldOffset = FloatingIsland::chunkCoordToWorldPos(chunkCoord);
-        
-        for (int x = 0; x < VoxelChunk::SIZE; x++)
+        bool hasSatellite = false;
+        for (uint32_t label = labels.firstLabel[i]; label < labels.firstLabel[i + 1] && !hasSatellite; ++label)
+            hasSatellite = labels.component[label] != keepComponent;
+        if (!hasSatellite) return;
+        
+        uint8_t voxels[CHUNK_VOLUME];
+        VoxelChunk* chunk = labels.chunks[i];
+        chunk->copyRawVoxelData(voxels);
+        const uint16_t* chunkLabels = labels.chunkLabels(i);
+        int removed = 0;
+        for (int index = 0; index < CHUNK_VOLUME; ++index)
         {
-            for (int y = 0; y < VoxelChunk::SIZE; y++)
-            {
-                for (int z = 0; z < VoxelChunk::SIZE; z++)
-                {
-                    if (chunk->getVoxel(x, y, z) == 0) continue;
-                    
-                    Vec3 islandRelativePos = chunkWorldOffset + Vec3(x, y, z);
-                    
-                    // If this voxel is NOT in the main island, remove it
-                    if (mainIslandVoxels.find(islandRelativePos) == mainIslandVoxels.end())
-                    {
-                        chunk->setVoxel(x, y, z, 0);
-                        voxelsRemoved++;
-                    }
-                }
-            }
+            if (chunkLabels[index] == 0 || labels.component[labels.globalLabel(i, chunkLabels[index])] == keepComponent) continue;
+            voxels[index] = 0;
+            removed++;
         }
-    }
+        chunk->setRawVoxelData(voxels, CHUNK_VOLUME);
+        chunk->markLightingDirty();
+        voxelsRemoved += removed;
+    });
     
     auto deletionEnd = std::chrono::high_resolution_clock::now();
     auto deletionDuration = std::chrono::duration_cast<std::chrono::milliseconds>(deletionEnd - deletionStart).count();
@@ -213,31 +281,25 @@ bool ConnectivityAnalyzer::wouldBreakingSplitIsland(const FloatingIsland* island
 {
     if (!island) return false;
     
+    VoxelAccessor voxels(*island);
+    const ChunkCoord removedPos = ChunkCoord::fromVec3(islandRelativePos);
+    
     // Check if the voxel exists
-    if (!isSolidVoxel(island, islandRelativePos)) return false;
+    if (!voxels.isSolid(removedPos)) return false;
     
     // Get all solid neighbors
-    std::vector<Vec3> neighbors = getNeighbors(islandRelativePos);
-    std::vector<Vec3> solidNeighbors;
-    
-    for (const Vec3& neighbor : neighbors)
-    {
-        if (isSolidVoxel(island, neighbor))
-        {
-            solidNeighbors.push_back(neighbor);
-        }
-    }
+    std::vector<ChunkCoord> solidNeighbors = getSolidNeighbors(voxels, removedPos);
     
     // If 0 or 1 solid neighbors, removing this won't split anything
     if (solidNeighbors.size() <= 1) return false;
     
     // Check if all solid neighbors are still connected without this voxel
     // Use temporary visited set to simulate removal
-    std::unordered_set<Vec3> visited;
-    visited.insert(islandRelativePos);  // Treat as already visited (removed)
+    ChunkCoordSet visited;
+    visited.insert(removedPos);  // Treat as already visited (removed)
     
     // Start flood-fill from first solid neighbor
-    std::queue<Vec3> queue;
+    std::queue<ChunkCoord> queue;
     queue.push(solidNeighbors[0]);
     visited.insert(solidNeighbors[0]);
     
@@ -245,22 +307,22 @@ bool ConnectivityAnalyzer::wouldBreakingSplitIsland(const FloatingIsland* island
     
     while (!queue.empty())
     {
-        Vec3 current = queue.front();
+        ChunkCoord current = queue.front();
         queue.pop();
         
-        for (const Vec3& neighbor : getNeighbors(current))
+        for (const ChunkCoord& neighbor : getNeighbors(current))
         {
             // Skip if already visited or is the removed voxel
-            if (visited.find(neighbor) != visited.end()) continue;
+            if (visited.contains(neighbor)) continue;
             
             // Skip if not solid
-            if (!isSolidVoxel(island, neighbor)) continue;
+            if (!voxels.isSolid(neighbor)) continue;
             
             visited.insert(neighbor);
             queue.push(neighbor);
             
             // Check if this neighbor is one of our original solid neighbors
-            for (const Vec3& originalNeighbor : solidNeighbors)
+            for (const ChunkCoord& originalNeighbor : solidNeighbors)
             {
                 if (neighbor == originalNeighbor)
                 {
@@ -320,13 +382,13 @@ std::vector<uint32_t> ConnectivityAnalyzer::splitIslandByConnectivity(
         
         // Create new island for this group
         const ConnectedGroup& group = groups[i];
-        uint32_t newIslandID = system->createIsland(originalIsland->physicsCenter + group.centerOfMass);
+        uint32_t newIslandID = system->createIsland(originalIsland->getPhysicsCenter() + group.centerOfMass);
         
         // Copy voxels from group to new island
         for (const Vec3& voxelPos : group.voxelPositions)
         {
             // Get voxel type from original island
-            Vec3 chunkCoord = FloatingIsland::islandPosToChunkCoord(voxelPos);
+            ChunkCoord chunkCoord = FloatingIsland::islandPosToChunkCoord(voxelPos);
             Vec3 localPos = FloatingIsland::islandPosToLocalPos(voxelPos);
             
             // Note: Would need to implement getVoxel from island-relative position
@@ -340,7 +402,7 @@ std::vector<uint32_t> ConnectivityAnalyzer::splitIslandByConnectivity(
         {
             newIsland->velocity = originalIsland->velocity;
             // Add slight separation velocity
-            Vec3 separationDir = (group.centerOfMass - originalIsland->physicsCenter).normalized();
+            Vec3 separationDir = (group.centerOfMass - originalIsland->getPhysicsCenter()).normalized();
             newIsland->velocity = newIsland->velocity + separationDir * 2.0f;
         }
         
@@ -353,347 +415,150 @@ std::vector<uint32_t> ConnectivityAnalyzer::splitIslandByConnectivity(
     return newIslandIDs;
 }
 
-ConnectedGroup ConnectivityAnalyzer::floodFill(
-    const FloatingIsland* island,
-    const Vec3& startPos,
-    std::unordered_set<Vec3>& visited)
-{
-    ConnectedGroup group;
-    group.voxelCount = 0;
-    group.centerOfMass = Vec3(0, 0, 0);
-    
-    std::queue<Vec3> queue;
-    queue.push(startPos);
-    visited.insert(startPos);
-    
-    while (!queue.empty())
-    {
-        Vec3 current = queue.front();
-        queue.pop();
-        
-        // Add to group
-        group.voxelPositions.push_back(current);
-        group.centerOfMass = group.centerOfMass + current;
-        group.voxelCount++;
-        
-        // Check all 6 neighbors
-        for (const Vec3& neighbor : getNeighbors(current))
-        {
-            // Skip if already visited
-            if (visited.find(neighbor) != visited.end()) continue;
-            
-            // Skip if not solid
-            if (!isSolidVoxel(island, neighbor)) continue;
-            
-            // Mark as visited and add to queue
-            visited.insert(neighbor);
-            queue.push(neighbor);
-        }
-    }
-    
-    // Calculate center of mass
-    if (group.voxelCount > 0)
-    {
-        group.centerOfMass = group.centerOfMass / static_cast<float>(group.voxelCount);
-    }
-    
-    return group;
-}
-
-std::vector<Vec3> ConnectivityAnalyzer::getNeighbors(const Vec3& pos)
+std::array<ChunkCoord, 6> ConnectivityAnalyzer::getNeighbors(const ChunkCoord& pos)
 {
-    return {
-        Vec3(pos.x + 1, pos.y, pos.z),  // +X
-        Vec3(pos.x - 1, pos.y, pos.z),  // -X
-        Vec3(pos.x, pos.y + 1, pos.z),  // +Y
-        Vec3(pos.x, pos.y - 1, pos.z),  // -Y
-        Vec3(pos.x, pos.y, pos.z + 1),  // +Z
-        Vec3(pos.x, pos.y, pos.z - 1),  // -Z
-    };
+    return {{
+        ChunkCoord(pos.x + 1, pos.y, pos.z),  // +X
+        ChunkCoord(pos.x - 1, pos.y, pos.z),  // -X
+        ChunkCoord(pos.x, pos.y + 1, pos.z),  // +Y
+        ChunkCoord(pos.x, pos.y - 1, pos.z),  // -Y
+        ChunkCoord(pos.x, pos.y, pos.z + 1),  // +Z
+        ChunkCoord(pos.x, pos.y, pos.z - 1),  // -Z
+    }};
 }
 
-std::vector<Vec3> ConnectivityAnalyzer::getSolidNeighbors(const FloatingIsland* island, const Vec3& pos)
+std::vector<ChunkCoord> ConnectivityAnalyzer::getSolidNeighbors(VoxelAccessor& voxels, const ChunkCoord& pos)
 {
-    std::vector<Vec3> solidNeighbors;
-    for (const Vec3& neighbor : getNeighbors(pos))
-    {
-        if (isSolidVoxel(island, neighbor))
-        {
-            solidNeighbors.push_back(neighbor);
-        }
-    }
+    std::vector<ChunkCoord> solidNeighbors;
+    voxels.forEachSolidNeighbor(pos, [&](const ChunkCoord& neighbor) { solidNeighbors.push_back(neighbor); });
     return solidNeighbors;
 }
 
-int ConnectivityAnalyzer::floodFillCount(const FloatingIsland* island, const Vec3& startPos, const Vec3& excludePos)
+bool ConnectivityAnalyzer::wouldBreakingCauseSplit(const FloatingIsland* island, const ChunkStreamSource* source,
+                                                   const Vec3& islandRelativePos, Vec3& outFragmentAnchor)
 {
-    if (!isSolidVoxel(island, startPos))
-        return 0;
-    
-    std::unordered_set<Vec3> visited;
-    std::queue<Vec3> queue;
-    queue.push(startPos);
-    visited.insert(startPos);
+    if (!island) return false;
     
-    int count = 0;
+    if (!island->connectivity)
+        island->connectivity = std::make_unique<IslandConnectivity>();
     
-    while (!queue.empty())
-    {
-        Vec3 current = queue.front();
-        queue.pop();
-        count++;
-        
-        for (const Vec3& neighbor : getNeighbors(current))
-        {
-            // Skip the excluded position (the broken block)
-            if (neighbor == excludePos) continue;
-            
-            // Skip if already visited
-            if (visited.find(neighbor) != visited.end()) continue;
-            
-            // Skip if not solid
-            if (!isSolidVoxel(island, neighbor)) continue;
-            
-            visited.insert(neighbor);
-            queue.push(neighbor);
-        }
-    }
+    ChunkCoord fragmentAnchor;
+    if (!island->connectivity->wouldBreakCauseSplit(*island, source, ChunkCoord::fromVec3(islandRelativePos), fragmentAnchor))
+        return false;
     
-    return count;
+    outFragmentAnchor = fragmentAnchor.toVec3();
+    return true;
 }
 
-bool ConnectivityAnalyzer::wouldBreakingCauseSplit(const FloatingIsland* island, const Vec3& islandRelativePos, Vec3& outFragmentAnchor)
+uint32_t ConnectivityAnalyzer::extractFragmentToNewIsland(IslandChunkSystem* system, uint32_t originalIslandID, const Vec3& fragmentAnchor, FragmentChunks* outFragment)
 {
-    if (!island) return false;
+    if (!system) return 0;
     
-    // Get all solid neighbors of the block we're about to break
-    std::vector<Vec3> neighbors = getSolidNeighbors(island, islandRelativePos);
+    FloatingIsland* island = system->getIsland(originalIslandID);
+    if (!island) return 0;
+    if (!island->connectivity)
+        island->connectivity = std::make_unique<IslandConnectivity>();
     
-    // Only blocks with exactly 2 neighbors can cause a split
-    if (neighbors.size() != 2)
+    // The fragment's (chunk, label) nodes, grouped by chunk
+    std::vector<IslandConnectivity::Node> nodes;
+    if (!island->connectivity->gatherComponent(*island, system->getStreamSource(), ChunkCoord::fromVec3(fragmentAnchor), nodes))
+        return 0;
+    std::sort(nodes.begin(), nodes.end(), [](const IslandConnectivity::Node& a, const IslandConnectivity::Node& b)
     {
-        return false; // Can't split with 0, 1, 3, 4, 5, or 6 neighbors
+        if (a.chunkCoord.x != b.chunkCoord.x) return a.chunkCoord.x < b.chunkCoord.x;
+        if (a.chunkCoord.y != b.chunkCoord.y) return a.chunkCoord.y < b.chunkCoord.y;
+        if (a.chunkCoord.z != b.chunkCoord.z) return a.chunkCoord.z < b.chunkCoord.z;
+        return a.label < b.label;
+    });
+    std::vector<size_t> chunkFirstNode;
+    FragmentChunks fragment;
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (i == 0 || !(nodes[i].chunkCoord == nodes[i - 1].chunkCoord))
+        {
+            chunkFirstNode.push_back(i);
+            fragment.chunkCoords.push_back(nodes[i].chunkCoord);
+        }
     }
+    chunkFirstNode.push_back(nodes.size());
     
-    // Check if the 2 neighbors are adjacent to each other (6-way connectivity)
-    Vec3 diff = neighbors[0] - neighbors[1];
-    int manhattanDist = abs(diff.x) + abs(diff.y) + abs(diff.z);
-    
-    if (manhattanDist == 1)
+    // The fragment may reach into cold or evicted chunks - bring back those, nothing else
+    system->wakeChunks(originalIslandID, fragment.chunkCoords);
+    for (const ChunkCoord& chunkCoord : fragment.chunkCoords)
     {
-        // Neighbors are adjacent - they can connect directly, no split
-        return false;
+        if (!island->findChunk(chunkCoord))
+        {
+            std::cerr << "❌ Fragment chunk (" << chunkCoord.x << "," << chunkCoord.y << "," << chunkCoord.z
+                      << ") of island " << originalIslandID << " could not be loaded - split skipped" << std::endl;
+            return 0;
+        }
     }
     
-    // The 2 neighbors are NOT adjacent - breaking this block will split the island!
-    // OPTIMIZATION: Race flood-fill from both neighbors to find which side is smaller
-    // This avoids flood-filling a massive island when we only need the small fragment
-    
-    std::unordered_set<Vec3> visited0;
-    std::unordered_set<Vec3> visited1;
-    std::queue<Vec3> queue0;
-    std::queue<Vec3> queue1;
-    
-    visited0.insert(islandRelativePos); // Exclude the broken block
-    visited1.insert(islandRelativePos);
-    
-    queue0.push(neighbors[0]);
-    queue1.push(neighbors[1]);
-    visited0.insert(neighbors[0]);
-    visited1.insert(neighbors[1]);
-    
-    int count0 = 1;
-    int count1 = 1;
-    
-    // Race both flood-fills, alternating one step at a time
-    while (!queue0.empty() || !queue1.empty())
+    // Per chunk: relabel (same numbering as the graph) and keep the fragment's labels as the payload
+    const size_t chunkCount = fragment.chunkCoords.size();
+    fragment.voxels.resize(chunkCount * CHUNK_VOLUME);
+    std::vector<uint32_t> chunkVoxels(chunkCount, 0);
+    std::vector<Vec3> chunkSums(chunkCount, Vec3(0, 0, 0));
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
     {
-        // Expand fragment 0 by one layer
-        if (!queue0.empty())
+        const VoxelChunk* chunk = island->findChunk(fragment.chunkCoords[i]);
+        uint8_t* payload = fragment.voxels.data() + i * CHUNK_VOLUME;
+        uint16_t labels[CHUNK_VOLUME];
+        chunk->copyRawVoxelData(payload);
+        const uint16_t labelCount = IslandConnectivity::labelChunk(payload, labels);
+        
+        bool inFragment[CHUNK_VOLUME / 2 + 1] = {};  // 6-connected labels never exceed half the chunk
+        for (size_t node = chunkFirstNode[i]; node < chunkFirstNode[i + 1]; ++node)
         {
-            int layerSize = queue0.size();
-            for (int i = 0; i < layerSize; i++)
-            {
-                Vec3 current = queue0.front();
-                queue0.pop();
-                
-                for (const Vec3& neighbor : getNeighbors(current))
-                {
-                    if (visited0.find(neighbor) != visited0.end()) continue;
-                    if (!isSolidVoxel(island, neighbor)) continue;
-                    
-                    visited0.insert(neighbor);
-                    queue0.push(neighbor);
-                    count0++;
-                }
-            }
+            if (nodes[node].label <= labelCount)
+                inFragment[nodes[node].label] = true;
         }
         
-        // Expand fragment 1 by one layer
-        if (!queue1.empty())
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(fragment.chunkCoords[i]);
+        for (int index = 0; index < CHUNK_VOLUME; ++index)
         {
-            int layerSize = queue1.size();
-            for (int i = 0; i < layerSize; i++)
+            if (!inFragment[labels[index]])
             {
-                Vec3 current = queue1.front();
-                queue1.pop();
-                
-                for (const Vec3& neighbor : getNeighbors(current))
-                {
-                    if (visited1.find(neighbor) != visited1.end()) continue;
-                    if (!isSolidVoxel(island, neighbor)) continue;
-                    
-                    visited1.insert(neighbor);
-                    queue1.push(neighbor);
-                    count1++;
-                }
+                payload[index] = 0;
+                continue;
             }
+            chunkVoxels[i]++;
+            chunkSums[i] = chunkSums[i] + (origin + ChunkCoord(index & 15, (index >> 4) & 15, index >> 8)).toVec3();
         }
-        
-        // If one side finished (found all its voxels), it's the smaller fragment
-        if (queue0.empty() && !queue1.empty())
-        {
-            outFragmentAnchor = neighbors[0];
-            return true;
-        }
-        if (queue1.empty() && !queue0.empty())
-        {
-            outFragmentAnchor = neighbors[1];
-            return true;
-        }
-    }
-    
-    // Both finished at same time - pick the smaller count
-    outFragmentAnchor = (count0 <= count1) ? neighbors[0] : neighbors[1];
-    return true;
-}
-
-uint32_t ConnectivityAnalyzer::extractFragmentToNewIsland(IslandChunkSystem* system, uint32_t originalIslandID, const Vec3& fragmentAnchor, std::vector<Vec3>* outRemovedVoxels)
-{
-    if (!system) return 0;
-    
-    FloatingIsland* mainIsland = system->getIsland(originalIslandID);
-    if (!mainIsland) return 0;
-    
-    // Flood-fill from fragment anchor to find all fragment voxels
-    std::unordered_set<Vec3> fragmentVoxels;
-    std::queue<Vec3> queue;
-    queue.push(fragmentAnchor);
-    fragmentVoxels.insert(fragmentAnchor);
+    });
     
     Vec3 centerOfMass(0, 0, 0);
-    
-    while (!queue.empty())
+    for (size_t i = 0; i < chunkCount; ++i)
     {
-        Vec3 current = queue.front();
-        queue.pop();
-        
-        centerOfMass = centerOfMass + current;
-        
-        for (const Vec3& neighbor : getNeighbors(current))
-        {
-            if (fragmentVoxels.find(neighbor) != fragmentVoxels.end()) continue;
-            if (!isSolidVoxel(mainIsland, neighbor)) continue;
-            
-            fragmentVoxels.insert(neighbor);
-            queue.push(neighbor);
-        }
+        fragment.voxelCount += chunkVoxels[i];
+        centerOfMass = centerOfMass + chunkSums[i];
     }
+    if (fragment.voxelCount == 0) return 0;
+    centerOfMass = centerOfMass / static_cast<float>(fragment.voxelCount);
     
-    if (fragmentVoxels.empty()) return 0;
+    // Re-center on the chunk nearest the fragment's center of mass - whole-chunk shifts keep payloads intact
+    const ChunkCoord centerVoxel = ChunkCoord::fromVec3(centerOfMass);
+    fragment.chunkOffset = FloatingIsland::voxelToChunkCoord(centerVoxel + ChunkCoord(CHUNK_SIZE / 2, CHUNK_SIZE / 2, CHUNK_SIZE / 2));
     
-    centerOfMass = centerOfMass / static_cast<float>(fragmentVoxels.size());
-    
-    // Create new island for fragment
-    // Physics center should be in WORLD space (main island world pos + fragment's local center of mass)
-    Vec3 worldCenterOfMass = mainIsland->physicsCenter + centerOfMass;
-    uint32_t newIslandID = system->createIsland(worldCenterOfMass);
+    uint32_t newIslandID = system->splitChunksToNewIsland(originalIslandID, fragment.chunkCoords, fragment.voxels.data(),
+                                                          fragment.chunkOffset);
     FloatingIsland* newIsland = system->getIsland(newIslandID);
-    
     if (!newIsland) return 0;
     
-    // Copy voxels from main island to fragment island and remove from main
-    for (const Vec3& voxelPos : fragmentVoxels)
-    {
-        // Get voxel type from main island (before we delete it)
-        uint8_t voxelType = 0;
-        Vec3 chunkCoord = FloatingIsland::islandPosToChunkCoord(voxelPos);
-        Vec3 localPos = FloatingIsland::islandPosToLocalPos(voxelPos);
-        
-        auto it = mainIsland->chunks.find(chunkCoord);
-        if (it != mainIsland->chunks.end() && it->second)
-        {
-            int lx = static_cast<int>(localPos.x);
-            int ly = static_cast<int>(localPos.y);
-            int lz = static_cast<int>(localPos.z);
-            
-            if (lx >= 0 && lx < VoxelChunk::SIZE &&
-                ly >= 0 && ly < VoxelChunk::SIZE &&
-                lz >= 0 && lz < VoxelChunk::SIZE)
-            {
-                voxelType = it->second->getVoxel(lx, ly, lz);
-            }
-        }
-        
-        if (voxelType != 0)
-        {
-            // Place voxel in new island at position relative to fragment's center of mass
-            // This makes the fragment centered at (0,0,0) in the new island's local space
-            Vec3 newIslandRelativePos = voxelPos - centerOfMass;
-            system->setVoxelInIsland(newIslandID, newIslandRelativePos, voxelType);
-            
-            // Remove from main island using setVoxelInIsland to properly rebuild meshes
-            system->setVoxelInIsland(originalIslandID, voxelPos, 0);
-            
-            // Track removed voxel for network broadcast
-            if (outRemovedVoxels)
-            {
-                outRemovedVoxels->push_back(voxelPos);
-            }
-        }
-    }
-    
-    // Apply separation physics
+    // Apply separation physics - on top of the source's motion the fragment inherited, pushed away
+    // from the source center (island-local, so rotated into world space)
     Vec3 separationDir = centerOfMass.normalized();
     if (separationDir.length() < 0.01f)
     {
         // If center of mass is at origin, use random direction
         separationDir = Vec3(1, 0, 0);
     }
-    newIsland->velocity = mainIsland->velocity + separationDir * 0.5f;
+    newIsland->velocity = newIsland->velocity + island->localDirToWorld(separationDir) * 0.5f;
     
-    std::cout << "🌊 Island split! Fragment with " << fragmentVoxels.size() 
-              << " voxels broke off and became island " << newIslandID << std::endl;
+    std::cout << "🌊 Island split! Fragment with " << fragment.voxelCount << " voxels in " << chunkCount
+              << " chunks broke off and became island " << newIslandID << std::endl;
     
+    if (outFragment)
+        *outFragment = std::move(fragment);
     return newIslandID;
 }
-
-bool ConnectivityAnalyzer::isSolidVoxel(const FloatingIsland* island, const Vec3& islandRelativePos)
-{
-    if (!island) return false;
-    
-    // Convert to chunk coordinates
-    Vec3 chunkCoord = FloatingIsland::islandPosToChunkCoord(islandRelativePos);
-    Vec3 localPos = FloatingIsland::islandPosToLocalPos(islandRelativePos);
-    
-    // Get chunk
-    auto it = island->chunks.find(chunkCoord);
-    if (it == island->chunks.end()) return false;
-    
-    const VoxelChunk* chunk = it->second.get();
-    if (!chunk) return false;
-    
-    // Get voxel
-    int lx = static_cast<int>(localPos.x);
-    int ly = static_cast<int>(localPos.y);
-    int lz = static_cast<int>(localPos.z);
-    
-    if (lx < 0 || lx >= VoxelChunk::SIZE ||
-        ly < 0 || ly >= VoxelChunk::SIZE ||
-        lz < 0 || lz >= VoxelChunk::SIZE)
-    {
-        return false;
-    }
-    
-    return (chunk->getVoxel(lx, ly, lz) != 0);
-}
@@ -1,13 +1,17 @@
 // ConnectivityAnalyzer.h - Detects separate connected voxel groups
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <unordered_set>
 #include <queue>
 #include "../Math/Vec3.h"
+#include "ChunkCoord.h"
 
+class ChunkStreamSource;
 struct FloatingIsland;
 class IslandChunkSystem;
+class VoxelAccessor;
 
 // Result of connectivity analysis
 struct ConnectedGroup
@@ -17,6 +21,16 @@ struct ConnectedGroup
     size_t voxelCount;                  // Number of voxels
 };
 
+// Whole-chunk payload of an extracted fragment - what extractFragmentToNewIsland moved, ready to
+// replicate as is (IslandChunkSystem::splitChunksToNewIsland applies it on the other side)
+struct FragmentChunks
+{
+    std::vector<ChunkCoord> chunkCoords;  // Source-island chunks the fragment touches
+    std::vector<uint8_t> voxels;          // VOLUME bytes per chunk, same order - air outside the fragment
+    ChunkCoord chunkOffset;               // Fragment-island chunk = source chunk - chunkOffset
+    size_t voxelCount = 0;
+};
+
 // Analyzes voxel connectivity to detect separate islands
 class ConnectivityAnalyzer
 {
@@ -27,20 +41,24 @@ public:
     static std::vector<ConnectedGroup> analyzeIsland(const FloatingIsland* island);
     
     // **FAST PATH** - Remove satellite chunks, keeping only main island connected to anchor point
-    // Much faster than full analysis - use this for generation-time cleanup
+    // Same labelling pass as analyzeIsland without gathering positions - use this for generation-time cleanup
     // Returns number of voxels removed
     static int cleanupSatellites(FloatingIsland* island, const Vec3& mainIslandAnchor = Vec3(0, 0, 0));
     
-    // **ULTRA-FAST SPLIT CHECK** - Check if breaking a block would split the island
-    // Returns true if the block has exactly 2 non-adjacent neighbors (causing a split)
-    // outFragmentAnchor will be set to one of the neighbors for fragment extraction
-    static bool wouldBreakingCauseSplit(const FloatingIsland* island, const Vec3& islandRelativePos, Vec3& outFragmentAnchor);
+    // **INCREMENTAL SPLIT CHECK** - Check if breaking a block would split the island
+    // Answered from the island's persistent IslandConnectivity graph: bounded work unless the break
+    // cuts a chunk-level connection. Cold and evicted chunks count without being paged in (source:
+    // the island system's stream source). Call before the block is removed, on the voxel-writer thread.
+    // outFragmentAnchor will be set to a voxel of the smallest piece cut off, for fragment extraction
+    static bool wouldBreakingCauseSplit(const FloatingIsland* island, const ChunkStreamSource* source,
+                                        const Vec3& islandRelativePos, Vec3& outFragmentAnchor);
     
-    // **FRAGMENT EXTRACTION** - Extract a disconnected fragment to a new island
-    // Flood-fills from fragmentAnchor to find all voxels in the fragment
-    // Returns the ID of the newly created island
-    // outRemovedVoxels will contain all voxel positions removed from the original island (for network sync)
-    static uint32_t extractFragmentToNewIsland(IslandChunkSystem* system, uint32_t originalIslandID, const Vec3& fragmentAnchor, std::vector<Vec3>* outRemovedVoxels = nullptr);
+    // **FRAGMENT EXTRACTION** - Move a disconnected fragment to a new island
+    // The fragment is gathered from the island's connectivity graph and moved as whole chunk payloads,
+    // re-centered by whole chunks so no voxel moves in the world. Only the fragment's chunks are woken.
+    // Returns the ID of the newly created island (0 on failure)
+    // outFragment receives the moved payload (for network sync)
+    static uint32_t extractFragmentToNewIsland(IslandChunkSystem* system, uint32_t originalIslandID, const Vec3& fragmentAnchor, FragmentChunks* outFragment = nullptr);
     
     // Check if breaking a specific voxel would split the island (OLD METHOD - deprecated)
     // Returns true if the voxel is "critical" (connects two separate parts)
@@ -54,22 +72,16 @@ public:
     );
 
 private:
-    // 3D flood-fill to find all voxels connected to a starting position
-    static ConnectedGroup floodFill(
-        const FloatingIsland* island,
-        const Vec3& startPos,
-        std::unordered_set<Vec3>& visited
-    );
-    
-    // Count voxels reachable from start position (for fragment size comparison)
-    static int floodFillCount(const FloatingIsland* island, const Vec3& startPos, const Vec3& excludePos);
+    // Whole-island passes (analysis, satellite cleanup) label each chunk's solid voxels on the job
+    // system (6-connected, over a 16-bit-per-row occupancy mask), then union-find the per-chunk labels
+    // across shared chunk faces - linear in voxels, a few flat allocations per island.
+    // Break checks go through the island's persistent IslandConnectivity instead.
+    struct IslandLabels;
+    static void labelIsland(const FloatingIsland& island, IslandLabels& out);
     
     // Get all solid neighbors of a position
-    static std::vector<Vec3> getSolidNeighbors(const FloatingIsland* island, const Vec3& pos);
+    static std::vector<ChunkCoord> getSolidNeighbors(VoxelAccessor& voxels, const ChunkCoord& pos);
     
     // Get all 6 neighbors (±X, ±Y, ±Z) for connectivity check
-    static std::vector<Vec3> getNeighbors(const Vec3& pos);
-    
-    // Check if a voxel exists at island-relative position
-    static bool isSolidVoxel(const FloatingIsland* island, const Vec3& islandRelativePos);
+    static std::array<ChunkCoord, 6> getNeighbors(const ChunkCoord& pos);
 };
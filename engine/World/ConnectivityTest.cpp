@@ -114,7 +114,6 @@ uint32_t createDisconnectedTestIsland() {
         for (auto& [chunkCoord, chunk] : island->chunks) {
             if (chunk) {
                 chunk->generateMesh();
-                chunk->buildCollisionMesh();
             }
         }
     }
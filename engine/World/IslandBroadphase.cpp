@@ -0,0 +1,188 @@
+// IslandBroadphase.cpp - World-space loose grid over island bounding boxes
+#include "IslandBroadphase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+ChunkCoord IslandBroadphase::cellOf(const Vec3& position)
+{
+    return ChunkCoord::fromVec3(Vec3(position.x / CELL_SIZE, position.y / CELL_SIZE, position.z / CELL_SIZE));
+}
+
+// Slab test of origin + dir * [0, maxDistance] against a box
+static bool segmentHitsBox(const Vec3& origin, const Vec3& dir, float maxDistance, const IslandBroadphase::Bounds& box)
+{
+    const float originAxis[3] = {origin.x, origin.y, origin.z};
+    const float dirAxis[3] = {dir.x, dir.y, dir.z};
+    const float boxMin[3] = {box.min.x, box.min.y, box.min.z};
+    const float boxMax[3] = {box.max.x, box.max.y, box.max.z};
+    float tMin = 0.0f;
+    float tMax = maxDistance;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        if (std::abs(dirAxis[axis]) < 1e-8f)
+        {
+            // Parallel to this slab - inside it or never
+            if (originAxis[axis] < boxMin[axis] || originAxis[axis] > boxMax[axis])
+                return false;
+            continue;
+        }
+        const float invD = 1.0f / dirAxis[axis];
+        float t0 = (boxMin[axis] - originAxis[axis]) * invD;
+        float t1 = (boxMax[axis] - originAxis[axis]) * invD;
+        if (invD < 0.0f)
+            std::swap(t0, t1);
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+        if (tMax < tMin)
+            return false;
+    }
+    return true;
+}
+
+bool IslandBroadphase::update(uint32_t islandID, const Bounds& bounds)
+{
+    auto it = m_islands.find(islandID);
+    if (it != m_islands.end())
+    {
+        if (it->second.fat.contains(bounds))
+            return false;
+        removeCells(islandID, it->second);
+    }
+
+    Entry& entry = m_islands[islandID];
+    const Vec3 margin(MARGIN, MARGIN, MARGIN);
+    entry.fat.min = bounds.min - margin;
+    entry.fat.max = bounds.max + margin;
+    entry.cellMin = cellOf(entry.fat.min);
+    entry.cellMax = cellOf(entry.fat.max);
+    const ChunkCoord span = entry.cellMax - entry.cellMin + ChunkCoord(1, 1, 1);
+    entry.oversized = static_cast<size_t>(span.x) * span.y * span.z > MAX_CELLS_PER_ISLAND;
+    insertCells(islandID, entry);
+    return true;
+}
+
+void IslandBroadphase::remove(uint32_t islandID)
+{
+    auto it = m_islands.find(islandID);
+    if (it == m_islands.end())
+        return;
+    removeCells(islandID, it->second);
+    m_islands.erase(it);
+}
+
+void IslandBroadphase::clear()
+{
+    m_islands.clear();
+    m_cells.clear();
+    m_oversized.clear();
+}
+
+void IslandBroadphase::insertCells(uint32_t islandID, const Entry& entry)
+{
+    if (entry.oversized)
+    {
+        m_oversized.push_back(islandID);
+        return;
+    }
+    for (int z = entry.cellMin.z; z <= entry.cellMax.z; ++z)
+    {
+        for (int y = entry.cellMin.y; y <= entry.cellMax.y; ++y)
+        {
+            for (int x = entry.cellMin.x; x <= entry.cellMax.x; ++x)
+                m_cells[ChunkCoord(x, y, z)].push_back(islandID);
+        }
+    }
+}
+
+void IslandBroadphase::removeCells(uint32_t islandID, const Entry& entry)
+{
+    if (entry.oversized)
+    {
+        m_oversized.erase(std::remove(m_oversized.begin(), m_oversized.end(), islandID), m_oversized.end());
+        return;
+    }
+    for (int z = entry.cellMin.z; z <= entry.cellMax.z; ++z)
+    {
+        for (int y = entry.cellMin.y; y <= entry.cellMax.y; ++y)
+        {
+            for (int x = entry.cellMin.x; x <= entry.cellMax.x; ++x)
+            {
+                auto cellIt = m_cells.find(ChunkCoord(x, y, z));
+                if (cellIt == m_cells.end())
+                    continue;
+                std::vector<uint32_t>& ids = cellIt->second;
+                ids.erase(std::remove(ids.begin(), ids.end(), islandID), ids.end());
+                if (ids.empty())
+                    m_cells.erase(cellIt);
+            }
+        }
+    }
+}
+
+void IslandBroadphase::gatherCandidates(const Bounds& box, std::vector<uint32_t>& outIslands) const
+{
+    const size_t first = outIslands.size();
+    outIslands.insert(outIslands.end(), m_oversized.begin(), m_oversized.end());
+
+    const ChunkCoord cellMin = cellOf(box.min);
+    const ChunkCoord cellMax = cellOf(box.max);
+    const ChunkCoord span = cellMax - cellMin + ChunkCoord(1, 1, 1);
+    if (static_cast<size_t>(span.x) * span.y * span.z > m_cells.size())
+    {
+        // Query bigger than the populated grid - walk the cells instead of the box
+        for (const auto& [cell, ids] : m_cells)
+        {
+            if (cell.x >= cellMin.x && cell.x <= cellMax.x && cell.y >= cellMin.y && cell.y <= cellMax.y &&
+                cell.z >= cellMin.z && cell.z <= cellMax.z)
+                outIslands.insert(outIslands.end(), ids.begin(), ids.end());
+        }
+    }
+    else
+    {
+        for (int z = cellMin.z; z <= cellMax.z; ++z)
+        {
+            for (int y = cellMin.y; y <= cellMax.y; ++y)
+            {
+                for (int x = cellMin.x; x <= cellMax.x; ++x)
+                {
+                    auto cellIt = m_cells.find(ChunkCoord(x, y, z));
+                    if (cellIt != m_cells.end())
+                        outIslands.insert(outIslands.end(), cellIt->second.begin(), cellIt->second.end());
+                }
+            }
+        }
+    }
+
+    // An island spanning several cells shows up once per cell
+    std::sort(outIslands.begin() + first, outIslands.end());
+    outIslands.erase(std::unique(outIslands.begin() + first, outIslands.end()), outIslands.end());
+}
+
+void IslandBroadphase::query(const Bounds& box, std::vector<uint32_t>& outIslands) const
+{
+    const size_t first = outIslands.size();
+    gatherCandidates(box, outIslands);
+    outIslands.erase(std::remove_if(outIslands.begin() + first, outIslands.end(),
+                                    [&](uint32_t islandID) { return !m_islands.at(islandID).fat.overlaps(box); }),
+                     outIslands.end());
+}
+
+void IslandBroadphase::queryRay(const Vec3& origin, const Vec3& dir, float maxDistance,
+                                std::vector<uint32_t>& outIslands) const
+{
+    const Vec3 end = origin + dir * maxDistance;
+    Bounds segment;
+    segment.min = Vec3(std::min(origin.x, end.x), std::min(origin.y, end.y), std::min(origin.z, end.z));
+    segment.max = Vec3(std::max(origin.x, end.x), std::max(origin.y, end.y), std::max(origin.z, end.z));
+
+    const size_t first = outIslands.size();
+    gatherCandidates(segment, outIslands);
+
+    outIslands.erase(std::remove_if(outIslands.begin() + first, outIslands.end(),
+                                    [&](uint32_t islandID) {
+                                        return !segmentHitsBox(origin, dir, maxDistance, m_islands.at(islandID).fat);
+                                    }),
+                     outIslands.end());
+}
@@ -0,0 +1,76 @@
+// IslandBroadphase.h - World-space loose grid over island bounding boxes
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ChunkCoord.h"
+#include "../Math/Vec3.h"
+
+// Every island is stored under a fat AABB (its world bounds grown by MARGIN) in each CELL_SIZE
+// cell that box overlaps. Moving or growing an island only reinserts it once its tight bounds leave
+// the fat box, so a drifting island costs a containment test per update. Queries visit the cells the
+// query box covers and return each island whose fat box passes - a conservative candidate list, the
+// caller still runs its narrow phase.
+//
+// Islands too big for the grid (more than MAX_CELLS_PER_ISLAND cells) sit in an oversized list
+// that every query tests directly.
+//
+// Not thread-safe - IslandChunkSystem guards it.
+class IslandBroadphase
+{
+   public:
+    static constexpr float CELL_SIZE = 128.0f;  // World units per cell (a few island radii)
+    static constexpr float MARGIN = 8.0f;       // Fat box slack per side
+    static constexpr size_t MAX_CELLS_PER_ISLAND = 512;
+
+    struct Bounds
+    {
+        Vec3 min;
+        Vec3 max;
+
+        bool overlaps(const Bounds& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+        bool contains(const Bounds& other) const
+        {
+            return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z && max.x >= other.max.x &&
+                   max.y >= other.max.y && max.z >= other.max.z;
+        }
+    };
+
+    // Insert or move an island; true when it had to be reinserted
+    bool update(uint32_t islandID, const Bounds& bounds);
+    void remove(uint32_t islandID);
+    void clear();
+
+    // Islands whose fat box overlaps the box / the segment origin + dir * [0, maxDistance]
+    // (dir normalized), each once, in no particular order
+    void query(const Bounds& box, std::vector<uint32_t>& outIslands) const;
+    void queryRay(const Vec3& origin, const Vec3& dir, float maxDistance, std::vector<uint32_t>& outIslands) const;
+
+    size_t size() const { return m_islands.size(); }
+
+   private:
+    struct Entry
+    {
+        Bounds fat;
+        ChunkCoord cellMin;
+        ChunkCoord cellMax;
+        bool oversized = false;
+    };
+
+    static ChunkCoord cellOf(const Vec3& position);
+    void insertCells(uint32_t islandID, const Entry& entry);
+    void removeCells(uint32_t islandID, const Entry& entry);
+    // Candidates from the cells under `box` (duplicates removed), before any per-island test
+    void gatherCandidates(const Bounds& box, std::vector<uint32_t>& outIslands) const;
+
+    std::unordered_map<uint32_t, Entry> m_islands;
+    ChunkCoordMap<std::vector<uint32_t>> m_cells;
+    std::vector<uint32_t> m_oversized;
+};
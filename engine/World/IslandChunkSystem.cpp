@@ -1,10 +1,12 @@
 // IslandChunkSystem.cpp - Implementation of physics-driven chunking
 #include "IslandChunkSystem.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <chrono>
@@ -13,10 +15,13 @@
 #include "VoxelChunk.h"
 #include "BlockType.h"
 #include "ConnectivityAnalyzer.h"
+#include "IslandDensity.h"
+#include "MeshWorkerPool.h"
+#include "../Core/JobSystem.h"
+#include "../Network/VoxelCompression.h"
 #include "../Profiling/Profiler.h"
 #include "../Rendering/MDIRenderer.h"
 #include "../Rendering/ModelInstanceRenderer.h"
-#include "../../libs/FastNoiseLite/FastNoiseLite.h"
 
 IslandChunkSystem g_islandSystem;
 
@@ -29,6 +34,10 @@ IslandChunkSystem::IslandChunkSystem()
 
 IslandChunkSystem::~IslandChunkSystem()
 {
+    // Generation jobs write into results we own
+    for (const GeneratingIsland& generating : m_generatingIslands)
+        g_jobSystem.wait(generating.job);
+    
     // Clean up all islands
     // Collect IDs first to avoid iterator invalidation
     std::vector<uint32_t> islandIDs;
@@ -51,7 +60,7 @@ uint32_t IslandChunkSystem::createIsland(const Vec3& physicsCenter)
 
 uint32_t IslandChunkSystem::createIsland(const Vec3& physicsCenter, uint32_t forceIslandID)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
+    std::unique_lock<std::shared_mutex> lock(m_islandsMutex);
     
     // Determine island ID
     uint32_t islandID;
@@ -74,7 +83,7 @@ uint32_t IslandChunkSystem::createIsland(const Vec3& physicsCenter, uint32_t for
     // Create the island
     FloatingIsland& island = m_islands[islandID];
     island.islandID = islandID;
-    island.physicsCenter = physicsCenter;
+    island.setPhysicsCenter(physicsCenter);
     island.needsPhysicsUpdate = true;
     island.acceleration = Vec3(0.0f, 0.0f, 0.0f);
     
@@ -87,269 +96,317 @@ uint32_t IslandChunkSystem::createIsland(const Vec3& physicsCenter, uint32_t for
 
 void IslandChunkSystem::destroyIsland(uint32_t islandID)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
+    // Exclusive table lock: no reader can be inside this island (they all hold the table shared)
+    std::unique_lock<std::shared_mutex> lock(m_islandsMutex);
     auto it = m_islands.find(islandID);
     if (it == m_islands.end())
         return;
 
+    for (auto& [chunkCoord, chunk] : it->second.chunks)
+        forgetDirtyChunk(chunk.get());
     m_islands.erase(it);
+    m_deferredIslands.erase(islandID);
+    m_unwatchedSeconds.erase(islandID);
+    // A generation still running keeps its own result alive and is simply never attached
+    m_generatingIslands.erase(std::remove_if(m_generatingIslands.begin(), m_generatingIslands.end(),
+                                             [islandID](const GeneratingIsland& generating) { return generating.islandID == islandID; }),
+                              m_generatingIslands.end());
+    
+    std::unique_lock<std::shared_mutex> broadphaseLock(m_broadphaseMutex);
+    m_broadphase.remove(islandID);
 }
 
-FloatingIsland* IslandChunkSystem::getIsland(uint32_t islandID)
+FloatingIsland* IslandChunkSystem::findIsland(uint32_t islandID)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
     auto it = m_islands.find(islandID);
     return (it != m_islands.end()) ? &it->second : nullptr;
 }
 
-const FloatingIsland* IslandChunkSystem::getIsland(uint32_t islandID) const
+const FloatingIsland* IslandChunkSystem::findIsland(uint32_t islandID) const
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
     auto it = m_islands.find(islandID);
     return (it != m_islands.end()) ? &it->second : nullptr;
 }
 
+FloatingIsland* IslandChunkSystem::getIsland(uint32_t islandID)
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    return findIsland(islandID);
+}
+
+const FloatingIsland* IslandChunkSystem::getIsland(uint32_t islandID) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    return findIsland(islandID);
+}
+
 Vec3 IslandChunkSystem::getIslandCenter(uint32_t islandID) const
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto it = m_islands.find(islandID);
-    if (it != m_islands.end())
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    const FloatingIsland* island = findIsland(islandID);
+    if (island)
     {
-        return it->second.physicsCenter;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        return island->getPhysicsCenter();
     }
     return Vec3(0.0f, 0.0f, 0.0f);  // Return zero vector if island not found
 }
 
 Vec3 IslandChunkSystem::getIslandVelocity(uint32_t islandID) const
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto it = m_islands.find(islandID);
-    if (it != m_islands.end())
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    const FloatingIsland* island = findIsland(islandID);
+    if (island)
     {
-        return it->second.velocity;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        return island->velocity;
     }
     return Vec3(0.0f, 0.0f, 0.0f);  // Return zero velocity if island not found
 }
 
-void IslandChunkSystem::addChunkToIsland(uint32_t islandID, const Vec3& chunkCoord)
+void IslandChunkSystem::addChunkToIsland(uint32_t islandID, const ChunkCoord& chunkCoord)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto itIsl = m_islands.find(islandID);
-    FloatingIsland* island = (itIsl != m_islands.end()) ? &itIsl->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
     if (!island)
         return;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
 
     // Check if chunk already exists
-    if (island->chunks.find(chunkCoord) != island->chunks.end())
+    if (island->chunks.contains(chunkCoord))
         return;
 
-    // Create new chunk and set island context
-    auto newChunk = std::make_unique<VoxelChunk>();
-    newChunk->setIslandContext(islandID, chunkCoord);
-    island->chunks[chunkCoord] = std::move(newChunk);
+    createChunkLocked(*island, islandID, chunkCoord);
 }
 
-void IslandChunkSystem::removeChunkFromIsland(uint32_t islandID, const Vec3& chunkCoord)
+void IslandChunkSystem::removeChunkFromIsland(uint32_t islandID, const ChunkCoord& chunkCoord)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto itIsl = m_islands.find(islandID);
-    FloatingIsland* island = (itIsl != m_islands.end()) ? &itIsl->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
     if (!island)
         return;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
 
     auto it = island->chunks.find(chunkCoord);
     if (it != island->chunks.end())
     {
+        unlinkChunkNeighbors(*island, chunkCoord);
+        forgetDirtyChunk(it->second.get());
         island->chunks.erase(it);
     }
+    island->coldChunks.erase(chunkCoord);
+}
+
+VoxelChunk* IslandChunkSystem::getOrCreateChunk(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord,
+                                             bool& outCreated)
+{
+    outCreated = false;
+    {
+        // Common case: the chunk exists - shared lock only
+        std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+        if (VoxelChunk* chunk = island.findChunk(chunkCoord))
+            return chunk;
+    }
+    
+    // Re-check under the exclusive lock - another writer may have created it in between
+    std::unique_lock<std::shared_mutex> islandLock(island.mutex);
+    if (VoxelChunk* chunk = island.findChunk(chunkCoord))
+        return chunk;
+    outCreated = true;
+    return createChunkLocked(island, islandID, chunkCoord);
+}
+
+VoxelChunk* IslandChunkSystem::createChunkLocked(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord)
+{
+    if (VoxelChunk* rehydrated = rehydrateChunkLocked(island, islandID, chunkCoord))
+        return rehydrated;
+
+    auto newChunk = std::make_unique<VoxelChunk>(m_chunkProfile);
+    newChunk->setIslandContext(islandID, chunkCoord);
+    linkChunkNeighbors(island, chunkCoord, newChunk.get());
+    VoxelChunk* chunk = newChunk.get();
+    island.chunks[chunkCoord] = std::move(newChunk);
+    if (island.growChunkBounds(chunkCoord))
+        updateBroadphase(island);
+    return chunk;
+}
+
+// Face offsets in VoxelChunk face order: 0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X (opposite face = face ^ 1)
+static const ChunkCoord s_chunkFaceOffsets[6] = {
+    ChunkCoord(0, -1, 0), ChunkCoord(0, 1, 0), ChunkCoord(0, 0, -1), ChunkCoord(0, 0, 1), ChunkCoord(-1, 0, 0), ChunkCoord(1, 0, 0)};
+
+void IslandChunkSystem::linkChunkNeighbors(FloatingIsland& island, const ChunkCoord& chunkCoord, VoxelChunk* chunk)
+{
+    for (int face = 0; face < 6; ++face)
+    {
+        auto it = island.chunks.find(chunkCoord + s_chunkFaceOffsets[face]);
+        VoxelChunk* neighbor = (it != island.chunks.end()) ? it->second.get() : nullptr;
+        chunk->setNeighbor(face, neighbor);
+        if (neighbor)
+            neighbor->setNeighbor(face ^ 1, chunk);
+    }
+}
+
+void IslandChunkSystem::unlinkChunkNeighbors(FloatingIsland& island, const ChunkCoord& chunkCoord)
+{
+    for (int face = 0; face < 6; ++face)
+    {
+        auto it = island.chunks.find(chunkCoord + s_chunkFaceOffsets[face]);
+        if (it != island.chunks.end() && it->second)
+            it->second->setNeighbor(face ^ 1, nullptr);
+    }
 }
 
-VoxelChunk* IslandChunkSystem::getChunkFromIsland(uint32_t islandID, const Vec3& chunkCoord)
+VoxelChunk* IslandChunkSystem::getChunkFromIsland(uint32_t islandID, const ChunkCoord& chunkCoord)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto itIsl = m_islands.find(islandID);
-    FloatingIsland* island = (itIsl != m_islands.end()) ? &itIsl->second : nullptr;
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
     if (!island)
         return nullptr;
 
-    auto it = island->chunks.find(chunkCoord);
-    if (it != island->chunks.end())
     {
-        return it->second.get();
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        if (VoxelChunk* chunk = island->findChunk(chunkCoord))
+            return chunk;
+        if (!island->coldChunks.contains(chunkCoord))
+            return nullptr;
     }
 
-    return nullptr;
+    // Cold - bring it back under the exclusive lock (re-checked: another caller may have already)
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
+    if (VoxelChunk* chunk = island->findChunk(chunkCoord))
+        return chunk;
+    return rehydrateChunkLocked(*island, islandID, chunkCoord);
 }
 
-void IslandChunkSystem::generateFloatingIslandOrganic(uint32_t islandID, uint32_t seed, float radius)
+void IslandChunkSystem::generateFloatingIslandOrganic(uint32_t islandID, uint32_t seed, float radius,
+                                                      ChunkProfile profile, GeneratedChunks& outChunks)
 {
     PROFILE_SCOPE("IslandChunkSystem::generateFloatingIslandOrganic");
     
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    FloatingIsland* island = getIsland(islandID);
-    if (!island)
-        return;
+    // Built on a private staging island - nothing here touches the system, so it runs on any thread
+    FloatingIsland staging;
+    FloatingIsland* island = &staging;
 
-    // Start with a center chunk at origin to ensure we have at least one chunk
-    addChunkToIsland(islandID, Vec3(0, 0, 0));
-    
     // **NOISE CONFIGURATION**
-    float densityThreshold = 0.35f;
-    float baseHeightRatio = 0.15f;
-    float noise3DFrequency = 0.02f;
-    float noise2DFrequency = 0.015f;
-    int fractalOctaves = 2;
-    float fractalGain = 0.4f;
+    IslandDensityField::Settings densitySettings;
+    densitySettings.seed = seed;
+    densitySettings.radius = radius;
     
     // **ENVIRONMENT OVERRIDES** for noise parameters
     const char* freq3DEnv = std::getenv("NOISE_FREQ_3D");
-    if (freq3DEnv) noise3DFrequency = std::stof(freq3DEnv);
+    if (freq3DEnv) densitySettings.noise3DFrequency = std::stof(freq3DEnv);
     
     const char* freq2DEnv = std::getenv("NOISE_FREQ_2D");
-    if (freq2DEnv) noise2DFrequency = std::stof(freq2DEnv);
+    if (freq2DEnv) densitySettings.noise2DFrequency = std::stof(freq2DEnv);
     
     const char* thresholdEnv = std::getenv("NOISE_THRESHOLD");
-    if (thresholdEnv) densityThreshold = std::stof(thresholdEnv);
-    
-    // Setup noise generators
-    FastNoiseLite noise3D;
-    noise3D.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
-    noise3D.SetSeed(seed);
-    noise3D.SetFrequency(noise3DFrequency);
-    noise3D.SetFractalType(FastNoiseLite::FractalType_FBm);
-    noise3D.SetFractalOctaves(fractalOctaves);
-    noise3D.SetFractalLacunarity(2.0f);
-    noise3D.SetFractalGain(fractalGain);
-    
-    FastNoiseLite noise2D;
-    noise2D.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
-    noise2D.SetSeed(seed + 1000);
-    noise2D.SetFrequency(noise2DFrequency);
-    noise2D.SetFractalType(FastNoiseLite::FractalType_FBm);
-    noise2D.SetFractalOctaves(fractalOctaves);
-    noise2D.SetFractalLacunarity(2.0f);
-    noise2D.SetFractalGain(fractalGain);
-    
-    // **SURFACE CACHE** - Track surface positions for decoration pass
-    std::vector<Vec3> surfacePositions;
-    surfacePositions.reserve(static_cast<size_t>(radius * radius * 2));
+    if (thresholdEnv) densitySettings.densityThreshold = std::stof(thresholdEnv);
+    
+    // Density function (noise generators are const to sample - every chunk task shares it)
+    const IslandDensityField density(densitySettings);
     
     auto voxelGenStart = std::chrono::high_resolution_clock::now();
     
     // **SPHERE-BOUNDED DENSE SAMPLING**
     // Calculate island bounds (sphere + vertical extent)
-    int islandHeight = static_cast<int>(radius * baseHeightRatio);
-    int searchRadius = static_cast<int>(radius * 1.4f);
-    float radiusSquared = (radius * 1.4f) * (radius * 1.4f);
-    float radiusDivisor = 1.0f / (radius * 1.2f);
+    const int islandHeight = density.getIslandHeight();
+    const int searchRadius = density.getSearchRadius();
     
-    long long voxelsGenerated = 0;
-    long long voxelsSampled = 0;
-    long long voxelsSkipped = 0;
-    long long earlyRejects = 0;
+    // **CHUNK TASKS** - every chunk in the bounds the falloff doesn't prove empty
+    std::vector<ChunkCoord> taskCoords;
+    size_t chunksProvenEmpty = 0;
+    const ChunkCoord minChunk = FloatingIsland::voxelToChunkCoord(ChunkCoord(-searchRadius, -islandHeight, -searchRadius));
+    const ChunkCoord maxChunk = FloatingIsland::voxelToChunkCoord(ChunkCoord(searchRadius, islandHeight, searchRadius));
+    for (int cz = minChunk.z; cz <= maxChunk.z; ++cz)
+    {
+        for (int cy = minChunk.y; cy <= maxChunk.y; ++cy)
+        {
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx)
+            {
+                const ChunkCoord chunkCoord(cx, cy, cz);
+                if (density.isChunkProvablyEmpty(FloatingIsland::chunkCoordToVoxel(chunkCoord)))
+                    ++chunksProvenEmpty;
+                else
+                    taskCoords.push_back(chunkCoord);
+            }
+        }
+    }
     
-    auto noiseStart = std::chrono::high_resolution_clock::now();
-    long long noiseTimeUs = 0;
+    struct ChunkTaskResult
+    {
+        std::unique_ptr<VoxelChunk> chunk;             // Null when the chunk came out all air
+        std::vector<ChunkCoord> decorationCandidates;  // Solid voxels with air (or the next chunk) above
+        IslandDensityField::FillStats stats;
+    };
+    std::vector<ChunkTaskResult> results(taskCoords.size());
     
-    // Iterate with optimized loop order (Y outermost for better cache locality)
-    for (int y = -islandHeight; y <= islandHeight; y++)
+    // Each task fills its chunk's voxel array straight from the (column-cached, batched) density
+    // function - no locks, no map lookups - and builds the chunk off-island; attachChunksToIsland
+    // publishes them all at once. One job per chunk: cost varies a lot between surface and
+    // interior chunks, so let idle threads steal single chunks rather than whole ranges.
+    g_jobSystem.parallelFor(taskCoords.size(), [&](size_t task)
     {
-        float dy = static_cast<float>(y);
+        ChunkTaskResult& result = results[task];
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(taskCoords[task]);
+        uint8_t blockIDs[VoxelChunk::VOLUME] = {};
         
-        // **VERTICAL FALLOFF** - Pre-calculate for this Y layer
-        float islandHeightRange = islandHeight * 2.0f;
-        float normalizedY = (dy + islandHeight) / islandHeightRange;
-        float centerOffset = normalizedY - 0.5f;
-        float verticalDensity = 1.0f - (centerOffset * centerOffset * 4.0f);
-        verticalDensity = std::max(0.0f, verticalDensity);
+        density.fillChunk(origin, BlockID::DIRT, blockIDs, result.stats);
         
-        // **EARLY OUT** - Skip entire Y layer if vertical density too low
-        if (verticalDensity < 0.01f) {
-            continue;
-        }
+        if (result.stats.voxelsGenerated == 0)
+            return;  // All air - never attached
         
-        for (int x = -searchRadius; x <= searchRadius; x++)
+        for (int lz = 0; lz < VoxelChunk::SIZE; lz++)
         {
-            float dx = static_cast<float>(x);
-            float xSquared = dx * dx;
-            
-            for (int z = -searchRadius; z <= searchRadius; z++)
+            for (int ly = 0; ly < VoxelChunk::SIZE; ly++)
             {
-                voxelsSampled++;
-                
-                float dz = static_cast<float>(z);
-                
-                // **SPHERE CULLING** - Skip positions outside island radius
-                float distanceSquared = xSquared + dz * dz;
-                if (distanceSquared > radiusSquared) {
-                    voxelsSkipped++;
-                    continue;
-                }
-                
-                // **RADIAL FALLOFF** (cached sqrt and pre-calculated divisor)
-                float distanceFromCenter = std::sqrt(distanceSquared);
-                float islandBase = 1.0f - (distanceFromCenter * radiusDivisor);
-                islandBase = std::max(0.0f, islandBase);
-                islandBase = islandBase * islandBase;
-                
-                // **EARLY OUT** - Skip if radial falloff too low
-                if (islandBase < 0.01f) {
-                    earlyRejects++;
-                    continue;
-                }
-                
-                // Combined density from radial and vertical falloff
-                float baseDensity = islandBase * verticalDensity;
-                
-                // **EARLY OUT** - Skip noise if base density too low (saves 2 noise calls!)
-                if (baseDensity < 0.05f) {
-                    earlyRejects++;
-                    continue;
-                }
-                
-                auto densityStart = std::chrono::high_resolution_clock::now();
-                
-                // **3D PERLIN NOISE**
-                float volumetricNoise = noise3D.GetNoise(dx, dy, dz);
-                volumetricNoise = (volumetricNoise + 1.0f) * 0.5f;
-                
-                // **2D PERLIN NOISE**
-                float terrainNoise = noise2D.GetNoise(dx, dz);
-                terrainNoise = (terrainNoise + 1.0f) * 0.5f;
-                
-                // **FINAL DENSITY**
-                float finalDensity = islandBase * verticalDensity * (volumetricNoise * 0.6f + terrainNoise * 0.4f);
-                
-                auto densityEnd = std::chrono::high_resolution_clock::now();
-                noiseTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(densityEnd - densityStart).count();
-                
-                // Place voxel if density exceeds threshold
-                if (finalDensity > densityThreshold)
+                for (int lx = 0; lx < VoxelChunk::SIZE; lx++)
                 {
-                    Vec3 pos(x, y, z);
-                    setBlockIDWithAutoChunk(islandID, pos, BlockID::DIRT);
-                    surfacePositions.push_back(pos);
-                    voxelsGenerated++;
+                    const int index = lx + ly * VoxelChunk::SIZE + lz * VoxelChunk::SIZE * VoxelChunk::SIZE;
+                    if (blockIDs[index] == BlockID::AIR)
+                        continue;
+                    if (ly == VoxelChunk::SIZE - 1 || blockIDs[index + VoxelChunk::SIZE] == BlockID::AIR)
+                        result.decorationCandidates.push_back(origin + ChunkCoord(lx, ly, lz));
                 }
             }
         }
+        
+        result.chunk = std::make_unique<VoxelChunk>(profile);
+        result.chunk->setRawVoxelData(blockIDs, VoxelChunk::VOLUME);  // Packs at the smallest palette width
+    }, 1);
+    
+    long long voxelsGenerated = 0;
+    long long voxelsSampled = 0;
+    long long voxelsSkipped = 0;
+    long long earlyRejects = 0;
+    staging.chunks.reserve(results.size());
+    for (size_t task = 0; task < results.size(); ++task)
+    {
+        ChunkTaskResult& result = results[task];
+        voxelsGenerated += result.stats.voxelsGenerated;
+        voxelsSampled += result.stats.voxelsSampled;
+        voxelsSkipped += result.stats.voxelsSkipped;
+        earlyRejects += result.stats.earlyRejects;
+        if (result.chunk)
+            staging.chunks[taskCoords[task]] = std::move(result.chunk);
     }
+    const size_t chunksAttached = staging.chunks.size();
+    
+    // Start with a center chunk at origin to ensure we have at least one chunk
+    if (chunksAttached == 0)
+        staging.chunks[ChunkCoord(0, 0, 0)] = std::make_unique<VoxelChunk>(profile);
     
     auto voxelGenEnd = std::chrono::high_resolution_clock::now();
     auto voxelGenDuration = std::chrono::duration_cast<std::chrono::milliseconds>(voxelGenEnd - voxelGenStart).count();
     
-    long long noiseDuration = noiseTimeUs / 1000;
-    long long loopOverhead = voxelGenDuration - noiseDuration;
-    
     std::cout << "🔨 Voxel Generation: " << voxelGenDuration << "ms (" << voxelsGenerated << " voxels, " 
-              << island->chunks.size() << " chunks)" << std::endl;
+              << chunksAttached << " chunks)" << std::endl;
     std::cout << "   ├─ Positions Sampled: " << voxelsSampled << " (" << voxelsSkipped << " sphere culled, " 
               << earlyRejects << " density rejected)" << std::endl;
-    std::cout << "   ├─ Noise Generation: " << noiseDuration << "ms (" 
-              << (noiseDuration * 100 / std::max(1LL, voxelGenDuration)) << "%)" << std::endl;
-    std::cout << "   └─ Loop Overhead: " << loopOverhead << "ms (" 
-              << (loopOverhead * 100 / std::max(1LL, voxelGenDuration)) << "%)" << std::endl;
+    std::cout << "   ├─ Chunk Tasks: " << taskCoords.size() << " (" << (taskCoords.size() - chunksAttached) 
+              << " all air, " << chunksProvenEmpty << " more proven empty unsampled) on " << g_jobSystem.getThreadCount() << " threads" << std::endl;
     
     // Connectivity cleanup - remove disconnected satellite chunks
     auto connectivityStart = std::chrono::high_resolution_clock::now();
@@ -371,17 +428,34 @@ void IslandChunkSystem::generateFloatingIslandOrganic(uint32_t islandID, uint32_
     
     int grassPlaced = 0;
     
-    for (const Vec3& pos : surfacePositions) {
-        uint8_t blockID = getVoxelFromIsland(islandID, pos);
-        if (blockID == BlockID::AIR) continue;
-        
-        Vec3 above = pos + Vec3(0, 1, 0);
-        uint8_t blockAbove = getVoxelFromIsland(islandID, above);
-        if (blockAbove != BlockID::AIR) continue;
-        
-        if ((std::rand() % 100) < 25) {
-            setBlockIDWithAutoChunk(islandID, above, BlockID::DECOR_GRASS);
-            grassPlaced++;
+    {
+        // Staging chunk holding an island-local voxel (created on demand for grass above the top layer)
+        auto chunkAt = [&](const ChunkCoord& pos, ChunkCoord& local, bool create) -> VoxelChunk* {
+            const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(pos);
+            local = pos - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+            if (VoxelChunk* chunk = staging.findChunk(chunkCoord))
+                return chunk;
+            if (!create)
+                return nullptr;
+            auto& chunk = staging.chunks[chunkCoord];
+            chunk = std::make_unique<VoxelChunk>(profile);
+            return chunk.get();
+        };
+        for (const ChunkTaskResult& result : results) {
+            for (const ChunkCoord& pos : result.decorationCandidates) {
+                ChunkCoord local;
+                const VoxelChunk* chunk = chunkAt(pos, local, false);
+                if (!chunk || chunk->getVoxel(local.x, local.y, local.z) == BlockID::AIR) continue;  // Removed as a satellite
+                
+                ChunkCoord localAbove;
+                const VoxelChunk* chunkAbove = chunkAt(pos + ChunkCoord(0, 1, 0), localAbove, false);
+                if (chunkAbove && chunkAbove->getVoxel(localAbove.x, localAbove.y, localAbove.z) != BlockID::AIR) continue;
+                
+                if ((std::rand() % 100) < 25) {
+                    chunkAt(pos + ChunkCoord(0, 1, 0), localAbove, true)->setVoxel(localAbove.x, localAbove.y, localAbove.z, BlockID::DECOR_GRASS);
+                    grassPlaced++;
+                }
+            }
         }
     }
     
@@ -389,64 +463,38 @@ void IslandChunkSystem::generateFloatingIslandOrganic(uint32_t islandID, uint32_
     auto decorationDuration = std::chrono::duration_cast<std::chrono::milliseconds>(decorationEnd - decorationStart).count();
     std::cout << "🌿 Decoration: " << decorationDuration << "ms (" << grassPlaced << " grass)" << std::endl;
     
-    auto meshGenStart = std::chrono::high_resolution_clock::now();
-    
-    long long renderMeshTime = 0;
-    long long collisionMeshTime = 0;
-    long long mdiRegistrationTime = 0;
-    int chunksProcessed = 0;
+    auto compressStart = std::chrono::high_resolution_clock::now();
     
-    for (auto& [chunkCoord, chunk] : island->chunks)
+    // Everything leaves as cold chunks - the streaming update wakes (and meshes) the working set only
+    std::vector<std::pair<ChunkCoord, VoxelChunk*>> stagedChunks;
+    stagedChunks.reserve(staging.chunks.size());
+    for (auto& [chunkCoord, chunk] : staging.chunks)
     {
         if (chunk)
+            stagedChunks.emplace_back(chunkCoord, chunk.get());
+    }
+    outChunks.resize(stagedChunks.size());
+    g_jobSystem.parallelFor(stagedChunks.size(), [&](size_t i)
+    {
+        const VoxelChunk* chunk = stagedChunks[i].second;
+        uint8_t voxels[VoxelChunk::VOLUME];
+        chunk->copyRawVoxelData(voxels);
+        auto cold = std::make_unique<ColdChunk>();
+        if (VoxelCompression::compressLZ4(voxels, VoxelChunk::VOLUME, cold->compressed) == 0)
         {
-            auto renderMeshStart = std::chrono::high_resolution_clock::now();
-            chunk->generateMesh();
-            auto renderMeshEnd = std::chrono::high_resolution_clock::now();
-            renderMeshTime += std::chrono::duration_cast<std::chrono::microseconds>(renderMeshEnd - renderMeshStart).count();
-            
-            auto collisionMeshStart = std::chrono::high_resolution_clock::now();
-            chunk->buildCollisionMesh();
-            auto collisionMeshEnd = std::chrono::high_resolution_clock::now();
-            collisionMeshTime += std::chrono::duration_cast<std::chrono::microseconds>(collisionMeshEnd - collisionMeshStart).count();
-            
-            if (g_mdiRenderer)
-            {
-                auto mdiStart = std::chrono::high_resolution_clock::now();
-                
-                Vec3 chunkLocalPos(
-                    chunkCoord.x * VoxelChunk::SIZE,
-                    chunkCoord.y * VoxelChunk::SIZE,
-                    chunkCoord.z * VoxelChunk::SIZE
-                );
-                
-                glm::mat4 chunkTransform = island->getTransformMatrix() * 
-                    glm::translate(glm::mat4(1.0f), glm::vec3(chunkLocalPos.x, chunkLocalPos.y, chunkLocalPos.z));
-                
-                g_mdiRenderer->queueChunkRegistration(chunk.get(), chunkTransform);
-                
-                auto mdiEnd = std::chrono::high_resolution_clock::now();
-                mdiRegistrationTime += std::chrono::duration_cast<std::chrono::microseconds>(mdiEnd - mdiStart).count();
-            }
-            
-            chunksProcessed++;
+            std::cerr << "❌ Generated chunk (" << stagedChunks[i].first.x << "," << stagedChunks[i].first.y << ","
+                      << stagedChunks[i].first.z << ") of island " << islandID << " failed to compress" << std::endl;
+            return;
         }
-    }
-    
-    auto meshGenEnd = std::chrono::high_resolution_clock::now();
-    auto meshGenDuration = std::chrono::duration_cast<std::chrono::milliseconds>(meshGenEnd - meshGenStart).count();
+        cold->compressed.shrink_to_fit();
+        cold->unsavedChanges = true;  // Never saved - the world save has only the generation parameters
+        cold->voxelVersion = chunk->getVoxelVersion();
+        outChunks[i] = {stagedChunks[i].first, std::move(cold)};
+    });
     
-    long long renderMeshDuration = renderMeshTime / 1000;
-    long long collisionMeshDuration = collisionMeshTime / 1000;
-    long long mdiRegistrationDuration = mdiRegistrationTime / 1000;
-    
-    std::cout << "📐 Mesh Generation: " << meshGenDuration << "ms (" << chunksProcessed << " chunks)" << std::endl;
-    std::cout << "   ├─ Render: " << renderMeshDuration << "ms (" 
-              << (renderMeshDuration * 100 / std::max(1LL, meshGenDuration)) << "%)" << std::endl;
-    std::cout << "   ├─ Collision: " << collisionMeshDuration << "ms (" 
-              << (collisionMeshDuration * 100 / std::max(1LL, meshGenDuration)) << "%)" << std::endl;
-    std::cout << "   └─ MDI: " << mdiRegistrationDuration << "ms (" 
-              << (mdiRegistrationDuration * 100 / std::max(1LL, meshGenDuration)) << "%)" << std::endl;
+    auto compressEnd = std::chrono::high_resolution_clock::now();
+    auto compressDuration = std::chrono::duration_cast<std::chrono::milliseconds>(compressEnd - compressStart).count();
+    std::cout << "🗜️  Compression: " << compressDuration << "ms (" << stagedChunks.size() << " chunks)" << std::endl;
     
     auto totalEnd = std::chrono::high_resolution_clock::now();
     auto totalDuration = std::chrono::duration_cast<std::chrono::milliseconds>(totalEnd - startTime).count();
@@ -455,82 +503,554 @@ void IslandChunkSystem::generateFloatingIslandOrganic(uint32_t islandID, uint32_
     std::cout << "   └─ Breakdown: Voxels=" << voxelGenDuration << "ms (" 
               << (voxelGenDuration * 100 / std::max(1LL, totalDuration)) << "%), Decoration=" 
               << decorationDuration << "ms (" << (decorationDuration * 100 / std::max(1LL, totalDuration)) 
-              << "%), Meshes=" << meshGenDuration << "ms (" 
-              << (meshGenDuration * 100 / std::max(1LL, totalDuration)) << "%)" << std::endl;
+              << "%), Compression=" << compressDuration << "ms (" 
+              << (compressDuration * 100 / std::max(1LL, totalDuration)) << "%)" << std::endl;
 }
 
-uint8_t IslandChunkSystem::getVoxelFromIsland(uint32_t islandID, const Vec3& islandRelativePosition) const
+size_t IslandChunkSystem::attachChunksToIsland(uint32_t islandID,
+                                               std::vector<std::pair<ChunkCoord, std::unique_ptr<VoxelChunk>>>& chunks)
 {
-    // Hold lock across the entire access to prevent races
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
-    auto itIsl = m_islands.find(islandID);
-    if (itIsl == m_islands.end())
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
+    if (!island)
         return 0;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
 
-    const FloatingIsland& island = itIsl->second;
+    island->chunks.reserve(island->chunks.size() + chunks.size());
+    size_t attached = 0;
+    bool grew = false;
+    for (auto& [chunkCoord, chunk] : chunks)
+    {
+        // Existing chunks win - a batch never replaces live data (cold chunks are live too)
+        if (!chunk || island->chunks.contains(chunkCoord) || island->coldChunks.contains(chunkCoord))
+            continue;
+        
+        chunk->setIslandContext(islandID, chunkCoord);
+        linkChunkNeighbors(*island, chunkCoord, chunk.get());
+        island->chunks[chunkCoord] = std::move(chunk);
+        grew |= island->growChunkBounds(chunkCoord);
+        ++attached;
+    }
+    if (grew)
+        updateBroadphase(*island);
+    return attached;
+}
 
-    // Convert island-relative position to chunk coordinate and local voxel position
-    Vec3 chunkCoord = FloatingIsland::islandPosToChunkCoord(islandRelativePosition);
-    Vec3 localPos = FloatingIsland::islandPosToLocalPos(islandRelativePosition);
+void IslandChunkSystem::meshAttachedChunks(uint32_t islandID, const std::vector<std::pair<ChunkCoord, VoxelChunk*>>& chunks)
+{
+    PROFILE_SCOPE("IslandChunkSystem::meshAttachedChunks");
+    
+    // Mesh + collision in parallel - each build only reads neighbor voxels, which are final now.
+    // Inline on the caller: the mesh and collision must exist before the island is sent or
+    // simulated, so there is nothing to gain from the background pool here
+    g_jobSystem.parallelFor(chunks.size(), [&](size_t i)
+    {
+        VoxelChunk* chunk = chunks[i].second;
+        // Bulk writes only ever widen the palette - repack once they are done
+        chunk->compactVoxelStorage();
+        chunk->generateMesh();
+    }, 1);
+    
+    // Chunks already attached next to the batch were meshed against air where it now sits
+    std::unordered_set<const VoxelChunk*> batch;
+    batch.reserve(chunks.size());
+    for (const auto& entry : chunks)
+        batch.insert(entry.second);
+    for (const auto& entry : chunks)
+    {
+        for (int face = 0; face < 6; ++face)
+        {
+            VoxelChunk* neighbor = entry.second->getNeighbor(face);
+            if (neighbor && batch.find(neighbor) == batch.end())
+                markChunkDirty(neighbor);
+        }
+    }
+    
+    // No MDI registration here: these chunks belong to the server's world (which can evict them
+    // at any time), and the client registers the chunks it draws itself in syncPhysicsToChunks
+    (void)islandID;
+}
 
-    // Find the chunk
-    auto it = island.chunks.find(chunkCoord);
-    if (it == island.chunks.end())
-        return 0; // Chunk doesn't exist
+size_t IslandChunkSystem::detachChunksFromIsland(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords,
+                                                 std::vector<std::unique_ptr<VoxelChunk>>& outChunks)
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
+    if (!island)
+        return 0;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
 
-    const VoxelChunk* chunk = it->second.get();
-    if (!chunk)
+    size_t detached = 0;
+    for (const ChunkCoord& chunkCoord : chunkCoords)
+    {
+        auto it = island->chunks.find(chunkCoord);
+        if (it == island->chunks.end() || !it->second)
+            continue;
+        
+        unlinkChunkNeighbors(*island, chunkCoord);
+        forgetDirtyChunk(it->second.get());
+        for (int face = 0; face < 6; ++face)
+            it->second->setNeighbor(face, nullptr);  // Off the island now - no links back into it
+        outChunks.push_back(std::move(it->second));
+        island->chunks.erase(it);
+        ++detached;
+    }
+    return detached;
+}
+
+uint32_t IslandChunkSystem::splitChunksToNewIsland(uint32_t sourceIslandID, const std::vector<ChunkCoord>& sourceChunkCoords,
+                                                   const uint8_t* fragmentVoxels, const ChunkCoord& chunkOffset,
+                                                   uint32_t forceIslandID)
+{
+    PROFILE_SCOPE("IslandChunkSystem::splitChunksToNewIsland");
+    
+    // The fragment takes the source's pose and motion, its origin moved by whole chunks in the
+    // source's frame - a rotated source doesn't make the fragment jump or snap upright
+    Vec3 fragmentCenter;
+    Vec3 sourceRotation;
+    Vec3 sourceVelocity;
+    Vec3 sourceAngularVelocity;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        const FloatingIsland* source = findIsland(sourceIslandID);
+        if (!source)
+            return 0;
+        std::shared_lock<std::shared_mutex> islandLock(source->mutex);
+        fragmentCenter = source->localToWorld(FloatingIsland::chunkCoordToVoxel(chunkOffset).toVec3());
+        sourceRotation = source->getRotation();
+        sourceVelocity = source->velocity;
+        sourceAngularVelocity = source->angularVelocity;
+    }
+    const uint32_t newIslandID = createIsland(fragmentCenter, forceIslandID);
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        FloatingIsland* fragment = findIsland(newIslandID);
+        if (!fragment)
+            return 0;
+        std::unique_lock<std::shared_mutex> islandLock(fragment->mutex);
+        fragment->setPose(fragmentCenter, sourceRotation);
+        fragment->velocity = sourceVelocity;
+        fragment->angularVelocity = sourceAngularVelocity;
+    }
+    
+    // Fragment chunks are built off-island from their payloads, then attached in one batch
+    const size_t chunkCount = sourceChunkCoords.size();
+    std::vector<std::pair<ChunkCoord, std::unique_ptr<VoxelChunk>>> fragmentChunks(chunkCount);
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
+    {
+        auto chunk = std::make_unique<VoxelChunk>(m_chunkProfile);
+        chunk->setRawVoxelData(fragmentVoxels + i * VoxelChunk::VOLUME, VoxelChunk::VOLUME);
+        fragmentChunks[i] = {sourceChunkCoords[i] - chunkOffset, std::move(chunk)};
+    });
+    std::vector<VoxelChunk*> newChunks;
+    newChunks.reserve(chunkCount);
+    for (const auto& entry : fragmentChunks)
+        newChunks.push_back(entry.second.get());
+    attachChunksToIsland(newIslandID, fragmentChunks);
+    
+    // Clear the moved voxels from the source - one raw write per chunk (cold chunks come back first)
+    std::vector<VoxelChunk*> sourceChunks(chunkCount, nullptr);
+    for (size_t i = 0; i < chunkCount; ++i)
+        sourceChunks[i] = getChunkFromIsland(sourceIslandID, sourceChunkCoords[i]);
+    std::vector<uint8_t> exposedFaces(chunkCount, 0);  // Bit per face the cleared voxels touch
+    g_jobSystem.parallelFor(chunkCount, [&](size_t i)
+    {
+        VoxelChunk* chunk = sourceChunks[i];
+        if (!chunk)
+            return;
+        
+        const uint8_t* fragment = fragmentVoxels + i * VoxelChunk::VOLUME;
+        uint8_t voxels[VoxelChunk::VOLUME];
+        chunk->copyRawVoxelData(voxels);
+        uint8_t faces = 0;
+        for (int index = 0; index < VoxelChunk::VOLUME; ++index)
+        {
+            if (fragment[index] == 0 || voxels[index] == 0)
+                continue;
+            voxels[index] = 0;
+            
+            const int x = index % VoxelChunk::SIZE;
+            const int y = (index / VoxelChunk::SIZE) % VoxelChunk::SIZE;
+            const int z = index / (VoxelChunk::SIZE * VoxelChunk::SIZE);
+            faces |= (y == 0) << 0 | (y == VoxelChunk::SIZE - 1) << 1 | (z == 0) << 2 |
+                     (z == VoxelChunk::SIZE - 1) << 3 | (x == 0) << 4 | (x == VoxelChunk::SIZE - 1) << 5;
+        }
+        chunk->setRawVoxelData(voxels, VoxelChunk::VOLUME);
+        chunk->markLightingDirty();
+        exposedFaces[i] = faces;
+    });
+    
+    for (size_t i = 0; i < chunkCount; ++i)
+    {
+        if (!fragmentChunks[i].second)  // Attached (a duplicate coord stays behind and is dropped)
+            markChunkDirty(newChunks[i]);
+        if (!sourceChunks[i])
+            continue;
+        markChunkDirty(sourceChunks[i]);
+        for (int face = 0; face < 6; ++face)
+        {
+            if (exposedFaces[i] & (1 << face))
+                markChunkDirty(sourceChunks[i]->getNeighbor(face));
+        }
+    }
+    return newIslandID;
+}
+
+bool IslandChunkSystem::decodeColdChunk(const ColdChunk& cold, uint8_t* voxels)
+{
+    return VoxelCompression::decompressLZ4(cold.compressed.data(), static_cast<uint32_t>(cold.compressed.size()), voxels,
+                                           VoxelChunk::VOLUME);
+}
+
+size_t IslandChunkSystem::compactChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    PROFILE_SCOPE("IslandChunkSystem::compactChunks");
+    
+    std::vector<std::pair<ChunkCoord, VoxelChunk*>> hot;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        const FloatingIsland* island = findIsland(islandID);
+        if (!island)
+            return 0;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        hot.reserve(chunkCoords.size());
+        for (const ChunkCoord& chunkCoord : chunkCoords)
+        {
+            if (VoxelChunk* chunk = island->findChunk(chunkCoord))
+                hot.emplace_back(chunkCoord, chunk);
+        }
+    }
+    if (hot.empty())
+        return 0;
+
+    // Compression runs unlocked: this thread is the only one that writes voxels or removes chunks,
+    // so the pointers stay valid and the voxels stay put until the swap below
+    std::vector<std::unique_ptr<ColdChunk>> cold(hot.size());
+    g_jobSystem.parallelFor(hot.size(), [&](size_t i)
+    {
+        VoxelChunk* chunk = hot[i].second;
+        uint8_t voxels[VoxelChunk::VOLUME];
+        chunk->copyRawVoxelData(voxels);
+        auto compacted = std::make_unique<ColdChunk>();
+        if (VoxelCompression::compressLZ4(voxels, VoxelChunk::VOLUME, compacted->compressed) == 0)
+            return;  // Stays hot
+        compacted->compressed.shrink_to_fit();
+        compacted->unsavedChanges = chunk->hasUnsavedChanges();
+        compacted->idleSeconds = chunk->getIdleTime();
+        compacted->voxelVersion = chunk->getVoxelVersion();
+        cold[i] = std::move(compacted);
+    });
+
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
+    if (!island)
+        return 0;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
+
+    size_t compacted = 0;
+    for (size_t i = 0; i < hot.size(); ++i)
+    {
+        const ChunkCoord& chunkCoord = hot[i].first;
+        auto it = island->chunks.find(chunkCoord);
+        if (!cold[i] || it == island->chunks.end() || it->second.get() != hot[i].second)
+            continue;
+        
+        // Same as a detach - neighbors keep their meshes, the faces toward it stay culled
+        unlinkChunkNeighbors(*island, chunkCoord);
+        forgetDirtyChunk(it->second.get());
+        island->chunks.erase(it);
+        island->coldChunks[chunkCoord] = std::move(cold[i]);
+        ++compacted;
+    }
+    return compacted;
+}
+
+VoxelChunk* IslandChunkSystem::rehydrateChunkLocked(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord)
+{
+    auto it = island.coldChunks.find(chunkCoord);
+    if (it == island.coldChunks.end())
+        return nullptr;
+
+    auto chunk = std::make_unique<VoxelChunk>(m_chunkProfile);
+    uint8_t voxels[VoxelChunk::VOLUME];
+    if (decodeColdChunk(*it->second, voxels))
+    {
+        chunk->setRawVoxelData(voxels, VoxelChunk::VOLUME);
+        if (!it->second->unsavedChanges)
+            chunk->markSaved();
+    }
+    else
+    {
+        std::cerr << "❌ Cold chunk (" << chunkCoord.x << "," << chunkCoord.y << "," << chunkCoord.z << ") of island "
+                  << islandID << " failed to decode - it comes back empty" << std::endl;
+    }
+    island.coldChunks.erase(it);
+
+    chunk->setIslandContext(islandID, chunkCoord);
+    linkChunkNeighbors(island, chunkCoord, chunk.get());
+    VoxelChunk* rehydrated = chunk.get();
+    island.chunks[chunkCoord] = std::move(chunk);
+    markChunkDirty(rehydrated);
+    m_rehydratedChunks.fetch_add(1, std::memory_order_relaxed);
+    return rehydrated;
+}
+
+size_t IslandChunkSystem::rehydrateChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    PROFILE_SCOPE("IslandChunkSystem::rehydrateChunks");
+    
+    // Decode in parallel off-island (the cold entries stay put - only this thread removes them),
+    // then attach + mesh as one batch like freshly generated chunks
+    std::vector<std::pair<ChunkCoord, const ColdChunk*>> cold;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        const FloatingIsland* island = findIsland(islandID);
+        if (!island)
+            return 0;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        cold.reserve(chunkCoords.size());
+        for (const ChunkCoord& chunkCoord : chunkCoords)
+        {
+            auto it = island->coldChunks.find(chunkCoord);
+            if (it != island->coldChunks.end() && !island->chunks.contains(chunkCoord))
+                cold.emplace_back(chunkCoord, it->second.get());
+        }
+    }
+    if (cold.empty())
+        return 0;
+
+    std::vector<std::pair<ChunkCoord, std::unique_ptr<VoxelChunk>>> decoded(cold.size());
+    g_jobSystem.parallelFor(cold.size(), [&](size_t i)
+    {
+        uint8_t voxels[VoxelChunk::VOLUME];
+        if (!decodeColdChunk(*cold[i].second, voxels))
+            return;  // Stays cold
+        auto chunk = std::make_unique<VoxelChunk>(m_chunkProfile);
+        chunk->setRawVoxelData(voxels, VoxelChunk::VOLUME);
+        if (!cold[i].second->unsavedChanges)
+            chunk->markSaved();
+        decoded[i] = {cold[i].first, std::move(chunk)};
+    });
+
+    std::vector<std::pair<ChunkCoord, VoxelChunk*>> attached;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        FloatingIsland* island = findIsland(islandID);
+        if (!island)
+            return 0;
+        std::unique_lock<std::shared_mutex> islandLock(island->mutex);
+        attached.reserve(decoded.size());
+        for (auto& [chunkCoord, chunk] : decoded)
+        {
+            if (!chunk || island->chunks.contains(chunkCoord))
+                continue;
+            island->coldChunks.erase(chunkCoord);
+            chunk->setIslandContext(islandID, chunkCoord);
+            linkChunkNeighbors(*island, chunkCoord, chunk.get());
+            attached.emplace_back(chunkCoord, chunk.get());
+            island->chunks[chunkCoord] = std::move(chunk);
+        }
+    }
+
+    meshAttachedChunks(islandID, attached);
+    m_rehydratedChunks.fetch_add(attached.size(), std::memory_order_relaxed);
+    return attached.size();
+}
+
+size_t IslandChunkSystem::rehydrateIsland(uint32_t islandID)
+{
+    std::vector<ChunkCoord> chunkCoords;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        const FloatingIsland* island = findIsland(islandID);
+        if (!island)
+            return 0;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        chunkCoords.reserve(island->coldChunks.size());
+        for (const auto& [chunkCoord, cold] : island->coldChunks)
+            chunkCoords.push_back(chunkCoord);
+    }
+    return rehydrateChunks(islandID, chunkCoords);
+}
+
+size_t IslandChunkSystem::wakeChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    std::vector<ChunkCoord> cold;
+    std::vector<ChunkCoord> missing;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        const FloatingIsland* island = findIsland(islandID);
+        if (!island)
+            return 0;
+        std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+        for (const ChunkCoord& chunkCoord : chunkCoords)
+        {
+            if (island->chunks.contains(chunkCoord))
+                continue;
+            if (island->coldChunks.contains(chunkCoord))
+                cold.push_back(chunkCoord);
+            else
+                missing.push_back(chunkCoord);
+        }
+    }
+
+    size_t woken = cold.empty() ? 0 : rehydrateChunks(islandID, cold);
+    if (!missing.empty() && m_streamSource)
+        woken += m_streamSource->loadChunks(*this, islandID, missing);
+    return woken;
+}
+
+size_t IslandChunkSystem::dropColdChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
+    if (!island)
         return 0;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
 
-    // Get voxel from chunk using local coordinates
-    int x = static_cast<int>(localPos.x);
-    int y = static_cast<int>(localPos.y);
-    int z = static_cast<int>(localPos.z);
+    size_t dropped = 0;
+    for (const ChunkCoord& chunkCoord : chunkCoords)
+    {
+        auto it = island->coldChunks.find(chunkCoord);
+        if (it == island->coldChunks.end())
+            continue;
+        // The split-check graph keeps its labels - the stored voxels can't change until paged back in
+        if (island->connectivity)
+            island->connectivity->chunkStored(chunkCoord, it->second->voxelVersion);
+        island->coldChunks.erase(it);
+        ++dropped;
+    }
+    return dropped;
+}
 
-    // Check bounds (should be 0-15 for 16x16x16 chunks)
-    if (x < 0 || x >= VoxelChunk::SIZE || y < 0 || y >= VoxelChunk::SIZE || z < 0 || z >= VoxelChunk::SIZE)
+bool IslandChunkSystem::isChunkCold(uint32_t islandID, const ChunkCoord& chunkCoord) const
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    const FloatingIsland* island = findIsland(islandID);
+    if (!island)
+        return false;
+    std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+    return island->coldChunks.contains(chunkCoord);
+}
+
+uint8_t IslandChunkSystem::getVoxelFromIsland(uint32_t islandID, const Vec3& islandRelativePosition) const
+{
+    // Hold shared locks across the entire access - any number of readers run concurrently
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    const FloatingIsland* islandPtr = findIsland(islandID);
+    if (!islandPtr)
         return 0;
 
-    return chunk->getVoxel(x, y, z);
+    const FloatingIsland& island = *islandPtr;
+    std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+
+    // Convert island-relative position to chunk coordinate and local voxel position (integer math)
+    const ChunkCoord voxel = ChunkCoord::fromVec3(islandRelativePosition);
+    const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+
+    // Local coordinates are 0-15 by construction
+    const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+
+    // Find the chunk
+    if (const VoxelChunk* chunk = island.findChunk(chunkCoord))
+        return chunk->getVoxel(local.x, local.y, local.z);
+
+    // Cold chunks are read in place - decoding one is cheaper than rehydrating it for a single voxel
+    auto coldIt = island.coldChunks.find(chunkCoord);
+    if (coldIt == island.coldChunks.end())
+        return 0; // Chunk doesn't exist
+    uint8_t voxels[VoxelChunk::VOLUME];
+    if (!decodeColdChunk(*coldIt->second, voxels))
+        return 0;
+    return voxels[local.x + local.y * VoxelChunk::SIZE + local.z * VoxelChunk::SIZE * VoxelChunk::SIZE];
 }
 
 void IslandChunkSystem::setVoxelInIsland(uint32_t islandID, const Vec3& islandRelativePosition, uint8_t voxelType)
 {
     // Acquire chunk pointer under lock, then perform heavy work without holding the map mutex
     VoxelChunk* chunk = nullptr;
-    Vec3 localPos;
-    Vec3 chunkCoord;
-    Vec3 islandCenter;
+    ChunkCoord localPos;
+    ChunkCoord chunkCoord;
     bool isNewChunk = false;
     {
-        std::lock_guard<std::mutex> lock(m_islandsMutex);
-        auto itIsl = m_islands.find(islandID);
-        if (itIsl == m_islands.end())
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        FloatingIsland* islandPtr = findIsland(islandID);
+        if (!islandPtr)
             return;
-        FloatingIsland& island = itIsl->second;
-        chunkCoord = FloatingIsland::islandPosToChunkCoord(islandRelativePosition);
-        localPos = FloatingIsland::islandPosToLocalPos(islandRelativePosition);
-        islandCenter = island.physicsCenter;
-        std::unique_ptr<VoxelChunk>& chunkPtr = island.chunks[chunkCoord];
-        if (!chunkPtr)
-        {
-            chunkPtr = std::make_unique<VoxelChunk>();
-            chunkPtr->setIslandContext(islandID, chunkCoord);
-            isNewChunk = true;
-        }
-        chunk = chunkPtr.get();
+        FloatingIsland& island = *islandPtr;
+        const ChunkCoord voxel = ChunkCoord::fromVec3(islandRelativePosition);
+        chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+        localPos = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+        chunk = getOrCreateChunk(island, islandID, chunkCoord, isNewChunk);
     }
 
     // Set voxel and rebuild meshes outside of islands mutex to avoid deadlocks
-    int x = static_cast<int>(localPos.x);
-    int y = static_cast<int>(localPos.y);
-    int z = static_cast<int>(localPos.z);
-    if (x < 0 || x >= VoxelChunk::SIZE || y < 0 || y >= VoxelChunk::SIZE || z < 0 || z >= VoxelChunk::SIZE)
-        return;
+    const int x = localPos.x;
+    const int y = localPos.y;
+    const int z = localPos.z;
     
     chunk->setVoxel(x, y, z, voxelType);
-    chunk->generateMesh();
-    chunk->buildCollisionMesh();
+    markChunkDirty(chunk);
+    
+    // Boundary voxels also change the culled faces of the touching neighbor (0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X)
+    const int local[3] = {x, y, z};
+    static const int faceAxis[6] = {1, 1, 2, 2, 0, 0};
+    for (int face = 0; face < 6; ++face)
+    {
+        const int edge = (face & 1) ? VoxelChunk::SIZE - 1 : 0;
+        if (local[faceAxis[face]] == edge)
+            markChunkDirty(chunk->getNeighbor(face));
+    }
+}
+
+void IslandChunkSystem::markChunkDirty(VoxelChunk* chunk)
+{
+    if (!chunk)
+        return;
+    
+    std::lock_guard<std::mutex> lock(m_dirtyMutex);
+    ++m_remeshStats.requested;
+    m_dirtyChunks.insert(chunk);
+}
+
+void IslandChunkSystem::flushDirtyChunks()
+{
+    PROFILE_SCOPE("IslandChunkSystem::flushDirtyChunks");
+    
+    std::unordered_set<VoxelChunk*> dirty;
+    {
+        std::lock_guard<std::mutex> lock(m_dirtyMutex);
+        if (m_dirtyChunks.empty())
+            return;
+        dirty.swap(m_dirtyChunks);
+        m_remeshStats.executed += dirty.size();
+    }
+    
+    for (VoxelChunk* chunk : dirty)
+        remeshChunk(chunk);
+}
+
+IslandChunkSystem::RemeshStats IslandChunkSystem::getRemeshStats() const
+{
+    std::lock_guard<std::mutex> lock(m_dirtyMutex);
+    return m_remeshStats;
+}
+
+void IslandChunkSystem::forgetDirtyChunk(VoxelChunk* chunk)
+{
+    std::lock_guard<std::mutex> lock(m_dirtyMutex);
+    m_dirtyChunks.erase(chunk);
+}
+
+void IslandChunkSystem::remeshChunk(VoxelChunk* chunk)
+{
+    if (!chunk)
+        return;
+    
+    if (m_backgroundMeshing && g_meshWorkerPool)
+        g_meshWorkerPool->requestRemesh(chunk);  // Published (and uploaded) by the render thread
+    else
+        chunk->generateMesh();
 }
 
 void IslandChunkSystem::setVoxelWithAutoChunk(uint32_t islandID, const Vec3& islandRelativePos, uint8_t voxelType)
@@ -539,29 +1059,21 @@ void IslandChunkSystem::setVoxelWithAutoChunk(uint32_t islandID, const Vec3& isl
     VoxelChunk* chunk = nullptr;
     int localX = 0, localY = 0, localZ = 0;
     {
-        std::lock_guard<std::mutex> lock(m_islandsMutex);
-        auto itIsl = m_islands.find(islandID);
-        if (itIsl == m_islands.end())
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        FloatingIsland* island = findIsland(islandID);
+        if (!island)
             return;
-        FloatingIsland& island = itIsl->second;
-
-        int chunkX = static_cast<int>(std::floor(islandRelativePos.x / VoxelChunk::SIZE));
-        int chunkY = static_cast<int>(std::floor(islandRelativePos.y / VoxelChunk::SIZE));
-        int chunkZ = static_cast<int>(std::floor(islandRelativePos.z / VoxelChunk::SIZE));
-        Vec3 chunkCoord(chunkX, chunkY, chunkZ);
-
-        // Calculate local coordinates correctly for negative positions
-        // Use the same floor-based calculation to keep coordinates consistent
-        localX = static_cast<int>(std::floor(islandRelativePos.x)) - (chunkX * VoxelChunk::SIZE);
-        localY = static_cast<int>(std::floor(islandRelativePos.y)) - (chunkY * VoxelChunk::SIZE);
-        localZ = static_cast<int>(std::floor(islandRelativePos.z)) - (chunkZ * VoxelChunk::SIZE);
-
-        std::unique_ptr<VoxelChunk>& chunkPtr = island.chunks[chunkCoord];
-        if (!chunkPtr) {
-            chunkPtr = std::make_unique<VoxelChunk>();
-            chunkPtr->setIslandContext(islandID, chunkCoord);
-        }
-        chunk = chunkPtr.get();
+
+        // Floor-based integer split keeps negative positions consistent
+        const ChunkCoord voxel = ChunkCoord::fromVec3(islandRelativePos);
+        const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+        const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+        localX = local.x;
+        localY = local.y;
+        localZ = local.z;
+
+        bool created = false;
+        chunk = getOrCreateChunk(*island, islandID, chunkCoord, created);
     }
 
     if (!chunk) return;
@@ -583,9 +1095,11 @@ uint8_t IslandChunkSystem::getBlockIDInIsland(uint32_t islandID, const Vec3& isl
 void IslandChunkSystem::getAllChunks(std::vector<VoxelChunk*>& outChunks)
 {
     outChunks.clear();
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
     for (auto& [id, island] : m_islands)
     {
+        std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+        
         // Add all chunks from this island
         for (auto& [chunkCoord, chunk] : island.chunks)
         {
@@ -606,28 +1120,74 @@ void IslandChunkSystem::getVisibleChunks(const Vec3& viewPosition,
 
 void IslandChunkSystem::updateIslandPhysics(float deltaTime)
 {
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
+    std::vector<std::pair<uint32_t, IslandBroadphase::Bounds>> bounds;
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    bounds.reserve(m_islands.size());
     for (auto& [id, island] : m_islands)
     {
-        // Apply velocity to position
-        island.physicsCenter.x += island.velocity.x * deltaTime;
-        island.physicsCenter.y += island.velocity.y * deltaTime;
-        island.physicsCenter.z += island.velocity.z * deltaTime;
+        std::unique_lock<std::shared_mutex> islandLock(island.mutex);
         
-        // Apply angular velocity to rotation
-        island.rotation.x += island.angularVelocity.x * deltaTime;
-        island.rotation.y += island.angularVelocity.y * deltaTime;
-        island.rotation.z += island.angularVelocity.z * deltaTime;
+        // Apply velocity to position and angular velocity to rotation
+        // (at rest this leaves the pose - and the cached transform - untouched)
+        island.setPose(island.getPhysicsCenter() + island.velocity * deltaTime,
+                       island.getRotation() + island.angularVelocity * deltaTime);
         
         island.needsPhysicsUpdate = true;
+        
+        // Every island, not just moving ones - poses set outside this system land here too
+        IslandBroadphase::Bounds islandBounds;
+        if (island.getWorldBounds(islandBounds.min, islandBounds.max))
+            bounds.emplace_back(id, islandBounds);
     }
+    
+    // Unchanged islands are one containment test each
+    std::unique_lock<std::shared_mutex> broadphaseLock(m_broadphaseMutex);
+    for (const auto& [id, islandBounds] : bounds)
+        m_broadphase.update(id, islandBounds);
+}
+
+void IslandChunkSystem::updateBroadphase(const FloatingIsland& island)
+{
+    IslandBroadphase::Bounds bounds;
+    if (!island.getWorldBounds(bounds.min, bounds.max))
+        return;
+    std::unique_lock<std::shared_mutex> broadphaseLock(m_broadphaseMutex);
+    m_broadphase.update(island.islandID, bounds);
+}
+
+void IslandChunkSystem::growIslandBounds(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    FloatingIsland* island = findIsland(islandID);
+    if (!island)
+        return;
+    std::unique_lock<std::shared_mutex> islandLock(island->mutex);
+    bool grew = false;
+    for (const ChunkCoord& chunkCoord : chunkCoords)
+        grew |= island->growChunkBounds(chunkCoord);
+    if (grew)
+        updateBroadphase(*island);
+}
+
+void IslandChunkSystem::queryIslandsInBox(const Vec3& worldMin, const Vec3& worldMax,
+                                          std::vector<uint32_t>& outIslandIDs) const
+{
+    std::shared_lock<std::shared_mutex> broadphaseLock(m_broadphaseMutex);
+    m_broadphase.query({worldMin, worldMax}, outIslandIDs);
+}
+
+void IslandChunkSystem::queryIslandsAlongRay(const Vec3& origin, const Vec3& direction, float maxDistance,
+                                             std::vector<uint32_t>& outIslandIDs) const
+{
+    std::shared_lock<std::shared_mutex> broadphaseLock(m_broadphaseMutex);
+    m_broadphase.queryRay(origin, direction, maxDistance, outIslandIDs);
 }
 
 void IslandChunkSystem::syncPhysicsToChunks()
 {
     // UNIFIED TRANSFORM UPDATE: Single source of truth for ALL rendering (MDI + GLB)
     // Event-driven: Only update chunks whose islands have actually moved
-    std::lock_guard<std::mutex> lock(m_islandsMutex);
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
     
     if (!g_mdiRenderer)
     {
@@ -635,29 +1195,18 @@ void IslandChunkSystem::syncPhysicsToChunks()
         return;
     }
     
-    // Cache OBJ block types once instead of querying every iteration
-    static std::vector<uint8_t> objBlockTypes;
-    static bool objBlockTypesCached = false;
-    if (!objBlockTypesCached)
-    {
-        auto& registry = BlockTypeRegistry::getInstance();
-        for (const auto& blockType : registry.getAllBlockTypes())
-        {
-            if (blockType.renderType == BlockRenderType::OBJ)
-            {
-                objBlockTypes.push_back(blockType.id);
-            }
-        }
-        objBlockTypesCached = true;
-    }
+    // OBJ block IDs come from the registry's property tables (kept current on registration)
+    const std::vector<uint8_t>& objBlockTypes = BlockTypeRegistry::getInstance().getPropertyTables().objIDs;
     
     for (auto& [id, island] : m_islands)
     {
+        std::unique_lock<std::shared_mutex> islandLock(island.mutex);  // Clears needsPhysicsUpdate
+        
         // Skip islands that haven't moved
         if (!island.needsPhysicsUpdate) continue;
         
-        // Calculate island transform once (includes rotation + translation)
-        glm::mat4 islandTransform = island.getTransformMatrix();
+        // Cached island transform (includes rotation + translation)
+        const glm::mat4& islandTransform = island.getTransformMatrix();
         
         // Update transforms for all chunks in this island
         for (auto& [chunkCoord, chunk] : island.chunks)
@@ -700,16 +1249,394 @@ void IslandChunkSystem::syncPhysicsToChunks()
     }
 }
 
-void IslandChunkSystem::updatePlayerChunks(const Vec3& playerPosition)
+// Every chunk coordinate within `radius` chunks (Euclidean) of `center`
+template <typename Fn>
+static void forEachChunkInSphere(const ChunkCoord& center, int radius, Fn&& fn)
+{
+    const int radiusSquared = radius * radius;
+    for (int dz = -radius; dz <= radius; ++dz)
+    {
+        for (int dy = -radius; dy <= radius; ++dy)
+        {
+            for (int dx = -radius; dx <= radius; ++dx)
+            {
+                if (dx * dx + dy * dy + dz * dz <= radiusSquared)
+                    fn(center + ChunkCoord(dx, dy, dz));
+            }
+        }
+    }
+}
+
+static int chunkDistanceSquared(const ChunkCoord& a, const ChunkCoord& b)
+{
+    const ChunkCoord d = a - b;
+    return d.x * d.x + d.y * d.y + d.z * d.z;
+}
+
+// The chunk a world position falls in, in the island's local grid (caller holds the island lock)
+static ChunkCoord localChunkOf(const FloatingIsland& island, const Vec3& worldPosition)
+{
+    return FloatingIsland::voxelToChunkCoord(ChunkCoord::fromVec3(island.worldToLocal(worldPosition)));
+}
+
+void IslandChunkSystem::deferIslandGeneration(uint32_t islandID, uint32_t seed, float radius)
+{
+    // Same bounds the generator samples: a box of searchRadius x islandHeight x searchRadius
+    IslandDensityField::Settings settings;
+    settings.seed = seed;
+    settings.radius = radius;
+    const IslandDensityField density(settings);
+    const float horizontal = static_cast<float>(density.getSearchRadius());
+    const float vertical = static_cast<float>(density.getIslandHeight());
+
+    DeferredIsland& deferred = m_deferredIslands[islandID];
+    deferred.seed = seed;
+    deferred.radius = radius;
+    deferred.boundingRadius = std::sqrt(2.0f * horizontal * horizontal + vertical * vertical);
+}
+
+bool IslandChunkSystem::isIslandGenerated(uint32_t islandID) const
+{
+    uint32_t seed;
+    float radius;
+    return !getDeferredGeneration(islandID, seed, radius);
+}
+
+bool IslandChunkSystem::getDeferredGeneration(uint32_t islandID, uint32_t& outSeed, float& outRadius) const
+{
+    auto it = m_deferredIslands.find(islandID);
+    if (it != m_deferredIslands.end())
+    {
+        outSeed = it->second.seed;
+        outRadius = it->second.radius;
+        return true;
+    }
+    
+    // Still generating - nothing is attached yet, so it saves as deferred
+    for (const GeneratingIsland& generating : m_generatingIslands)
+    {
+        if (generating.islandID == islandID)
+        {
+            outSeed = generating.params.seed;
+            outRadius = generating.params.radius;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t IslandChunkSystem::generateChunksAroundPoint(const Vec3& center)
 {
-    // Infinite world generation will be implemented in a future version
-    // For now, we manually create islands in GameState
+    if (m_deferredIslands.empty())
+        return 0;
+
+    struct PendingIsland
+    {
+        uint32_t islandID;
+        DeferredIsland params;
+    };
+    std::vector<PendingIsland> inRange;
+    const float reach = static_cast<float>(m_renderDistance * VoxelChunk::SIZE);
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        for (const auto& [islandID, deferred] : m_deferredIslands)
+        {
+            const FloatingIsland* island = findIsland(islandID);
+            if (!island)
+                continue;
+            std::shared_lock<std::shared_mutex> islandLock(island->mutex);
+            if ((island->getPhysicsCenter() - center).length() - deferred.boundingRadius <= reach)
+                inRange.push_back({islandID, deferred});
+        }
+    }
+    if (inRange.empty())
+        return 0;
+
+    PROFILE_SCOPE("IslandChunkSystem::generateChunksAroundPoint");
+    for (const PendingIsland& pending : inRange)
+        m_deferredIslands.erase(pending.islandID);
+
+    // One job per island (Normal priority). Each island splits itself into chunk jobs (High), so
+    // workers drain chunk work first and the pool stays at one thread per core no matter how many
+    // islands there are. Biggest islands are queued first - they are the ones idle workers steal.
+    std::stable_sort(inRange.begin(), inRange.end(),
+                     [](const PendingIsland& a, const PendingIsland& b) { return a.params.radius > b.params.radius; });
+
+    const ChunkProfile profile = m_chunkProfile;
+    for (const PendingIsland& pending : inRange)
+    {
+        auto result = std::make_shared<GeneratedChunks>();
+        JobSystem::JobHandle job = g_jobSystem.submit(
+            [pending, profile, result]() {
+                std::cout << "[WORLD] Generating island " << pending.islandID 
+                          << " (radius=" << pending.params.radius << ")..." << std::endl;
+                generateFloatingIslandOrganic(pending.islandID, pending.params.seed, pending.params.radius, profile, *result);
+            },
+            JobPriority::Normal);
+        m_generatingIslands.push_back({pending.islandID, pending.params, std::move(job), std::move(result)});
+    }
+    return inRange.size();
 }
 
-void IslandChunkSystem::generateChunksAroundPoint(const Vec3& center)
+size_t IslandChunkSystem::attachGeneratedIslands(bool waitForAll)
 {
-    // Chunk generation around points will be used for infinite world expansion
-    // Currently handled manually through createIsland()
+    if (m_generatingIslands.empty())
+        return 0;
+    PROFILE_SCOPE("IslandChunkSystem::attachGeneratedIslands");
+    
+    size_t attachedIslands = 0;
+    for (size_t i = 0; i < m_generatingIslands.size();)
+    {
+        GeneratingIsland& generating = m_generatingIslands[i];
+        if (waitForAll)
+            g_jobSystem.wait(generating.job);
+        else if (!JobSystem::isFinished(generating.job))
+        {
+            ++i;
+            continue;
+        }
+        
+        // Cold chunks go straight into the island - pointer moves under one exclusive lock, and
+        // the streaming update wakes whatever a player is near
+        {
+            std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+            if (FloatingIsland* island = findIsland(generating.islandID))
+            {
+                std::unique_lock<std::shared_mutex> islandLock(island->mutex);
+                island->coldChunks.reserve(island->coldChunks.size() + generating.result->size());
+                bool grew = false;
+                for (auto& [chunkCoord, cold] : *generating.result)
+                {
+                    // Existing chunks win - anything already there is live data
+                    if (!cold || island->chunks.contains(chunkCoord) || island->coldChunks.contains(chunkCoord))
+                        continue;
+                    island->coldChunks[chunkCoord] = std::move(cold);
+                    grew |= island->growChunkBounds(chunkCoord);
+                }
+                if (grew)
+                    updateBroadphase(*island);
+                ++attachedIslands;
+            }
+        }
+        
+        m_generatingIslands[i] = std::move(m_generatingIslands.back());
+        m_generatingIslands.pop_back();
+    }
+    return attachedIslands;
 }
 
+void IslandChunkSystem::getChunksInRange(const Vec3& worldPosition, std::vector<ChunkInRange>& outChunks) const
+{
+    const int radiusSquared = m_renderDistance * m_renderDistance;
+    const size_t sphereChunks = static_cast<size_t>(4.19f * radiusSquared * m_renderDistance);
+    
+    std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+    for (const auto& [islandID, island] : m_islands)
+    {
+        std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+        if (island.chunks.empty())
+            continue;
+        
+        // Walk whichever is smaller - the island's chunks or the sphere's coordinates
+        const ChunkCoord center = localChunkOf(island, worldPosition);
+        if (island.chunks.size() < sphereChunks)
+        {
+            for (const auto& [chunkCoord, chunk] : island.chunks)
+            {
+                if (chunk && chunkDistanceSquared(chunkCoord, center) <= radiusSquared)
+                    outChunks.push_back({islandID, chunkCoord, chunk.get()});
+            }
+        }
+        else
+        {
+            forEachChunkInSphere(center, m_renderDistance, [&](const ChunkCoord& chunkCoord) {
+                if (VoxelChunk* chunk = island.findChunk(chunkCoord))
+                    outChunks.push_back({islandID, chunkCoord, chunk});
+            });
+        }
+    }
+}
 
+void IslandChunkSystem::updatePlayerChunks(const std::vector<Vec3>& playerPositions)
+{
+    PROFILE_SCOPE("IslandChunkSystem::updatePlayerChunks");
+    
+    const auto now = std::chrono::steady_clock::now();
+    const float elapsedSeconds = m_lastStreamingUpdate.time_since_epoch().count() == 0
+                                     ? 0.0f
+                                     : std::chrono::duration<float>(now - m_lastStreamingUpdate).count();
+    m_lastStreamingUpdate = now;
+    
+    // Islands finished since the last update go in first, so this pass already wakes their working set
+    StreamingStats stats;
+    stats.generatedIslands = attachGeneratedIslands();
+    for (const Vec3& position : playerPositions)
+        generateChunksAroundPoint(position);
+    
+    // Islands whose bounds come within the keep radius of a player (one chunk of slack for chunk
+    // rounding), and which players - the rest get no sphere walk and no per-chunk pass
+    const float keepReach = static_cast<float>((m_renderDistance + EVICTION_MARGIN + 1) * VoxelChunk::SIZE);
+    std::unordered_map<uint32_t, std::vector<size_t>> nearPlayers;
+    std::vector<uint32_t> candidates;
+    for (size_t player = 0; player < playerPositions.size(); ++player)
+    {
+        const Vec3 reach(keepReach, keepReach, keepReach);
+        candidates.clear();
+        queryIslandsInBox(playerPositions[player] - reach, playerPositions[player] + reach, candidates);
+        for (uint32_t islandID : candidates)
+            nearPlayers[islandID].push_back(player);
+    }
+    
+    // Per island: working-set chunks that aren't hot (cold ones to rehydrate, the rest to page in),
+    // hot chunks to compact and cold chunks to evict. Players are placed in each island's local
+    // grid - islands move and rotate under them.
+    struct IslandInterest
+    {
+        uint32_t islandID;
+        std::vector<ChunkCoord> missing;
+        std::vector<ChunkCoord> wake;
+        std::vector<ChunkCoord> compact;
+        std::vector<ChunkCoord> evict;
+    };
+    std::vector<IslandInterest> interests;
+    {
+        const int workingRadiusSquared = m_renderDistance * m_renderDistance;
+        const int keepRadiusSquared = (m_renderDistance + EVICTION_MARGIN) * (m_renderDistance + EVICTION_MARGIN);
+        std::vector<ChunkCoord> centers;
+        auto nearestDistanceSquared = [&centers](const ChunkCoord& chunkCoord) {
+            int nearest = std::numeric_limits<int>::max();
+            for (const ChunkCoord& center : centers)
+                nearest = std::min(nearest, chunkDistanceSquared(chunkCoord, center));
+            return nearest;
+        };
+        
+        // Idle times are only touched by this thread, so shared locks are enough
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        interests.reserve(m_islands.size());
+        for (const auto& [islandID, island] : m_islands)
+        {
+            std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+            IslandInterest interest;
+            interest.islandID = islandID;
+            
+            auto nearIt = nearPlayers.find(islandID);
+            if (nearIt == nearPlayers.end())
+            {
+                // Out of every player's reach: hot chunks go cold at once, and the cold ones go to
+                // the stream source together once the island stayed out of reach long enough
+                for (const auto& [chunkCoord, chunk] : island.chunks)
+                    interest.compact.push_back(chunkCoord);
+                float& unwatchedSeconds = m_unwatchedSeconds[islandID];
+                unwatchedSeconds += elapsedSeconds;
+                if (m_streamSource && unwatchedSeconds >= EVICT_AFTER_SECONDS)
+                {
+                    for (const auto& [chunkCoord, cold] : island.coldChunks)
+                        interest.evict.push_back(chunkCoord);
+                }
+                if (!interest.compact.empty() || !interest.evict.empty())
+                    interests.push_back(std::move(interest));
+                continue;
+            }
+            m_unwatchedSeconds.erase(islandID);
+            
+            centers.clear();
+            for (size_t player : nearIt->second)
+                centers.push_back(localChunkOf(island, playerPositions[player]));
+            
+            ChunkCoordSet requested;  // Players' spheres overlap
+            for (const ChunkCoord& center : centers)
+            {
+                forEachChunkInSphere(center, m_renderDistance, [&](const ChunkCoord& chunkCoord) {
+                    if (island.chunks.contains(chunkCoord) || (centers.size() > 1 && !requested.insert(chunkCoord)))
+                        return;
+                    if (island.coldChunks.contains(chunkCoord))
+                        interest.wake.push_back(chunkCoord);
+                    else if (m_streamSource)
+                        interest.missing.push_back(chunkCoord);
+                });
+            }
+            
+            for (const auto& [chunkCoord, chunk] : island.chunks)
+            {
+                const int distanceSquared = nearestDistanceSquared(chunkCoord);
+                if (distanceSquared <= workingRadiusSquared)
+                {
+                    chunk->resetIdleTime();
+                    continue;
+                }
+                const float idleSeconds = chunk->advanceIdleTime(elapsedSeconds);
+                if (distanceSquared > keepRadiusSquared || idleSeconds >= COLD_AFTER_SECONDS)
+                    interest.compact.push_back(chunkCoord);
+            }
+            
+            for (const auto& [chunkCoord, cold] : island.coldChunks)
+            {
+                const int distanceSquared = nearestDistanceSquared(chunkCoord);
+                if (distanceSquared <= workingRadiusSquared)
+                    continue;  // Being rehydrated
+                cold->idleSeconds += elapsedSeconds;
+                if (m_streamSource && distanceSquared > keepRadiusSquared && cold->idleSeconds >= EVICT_AFTER_SECONDS)
+                    interest.evict.push_back(chunkCoord);
+            }
+            
+            if (!interest.missing.empty() || !interest.wake.empty() || !interest.compact.empty() || !interest.evict.empty())
+                interests.push_back(std::move(interest));
+        }
+    }
+    
+    // Tier moves and the source go through the locking API - no locks held here
+    for (const IslandInterest& interest : interests)
+    {
+        if (!interest.wake.empty())
+            rehydrateChunks(interest.islandID, interest.wake);
+        if (!interest.missing.empty())
+            stats.loadedChunks += m_streamSource->loadChunks(*this, interest.islandID, interest.missing);
+        if (!interest.compact.empty())
+            stats.compactedChunks += compactChunks(interest.islandID, interest.compact);
+        if (!interest.evict.empty())
+            stats.evictedChunks += m_streamSource->evictChunks(*this, interest.islandID, interest.evict);
+    }
+    
+    // Byte totals take a walk over every chunk - only redone when chunks changed tier
+    stats.rehydratedChunks = m_rehydratedChunks.exchange(0, std::memory_order_relaxed);
+    const bool tiersMoved = stats.loadedChunks > 0 || stats.compactedChunks > 0 || stats.rehydratedChunks > 0 ||
+                            stats.evictedChunks > 0 || stats.generatedIslands > 0;
+    if (!tiersMoved)
+    {
+        stats.hotBytes = m_streamingStats.hotBytes;
+        stats.coldBytes = m_streamingStats.coldBytes;
+    }
+    {
+        std::shared_lock<std::shared_mutex> lock(m_islandsMutex);
+        for (const auto& [islandID, island] : m_islands)
+        {
+            std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+            stats.residentChunks += island.chunks.size();
+            stats.coldChunks += island.coldChunks.size();
+            if (!tiersMoved)
+                continue;
+            for (const auto& [chunkCoord, chunk] : island.chunks)
+                stats.hotBytes += chunk->getMemoryUsage();
+            for (const auto& [chunkCoord, cold] : island.coldChunks)
+                stats.coldBytes += sizeof(ColdChunk) + cold->compressed.capacity();
+        }
+    }
+    stats.deferredIslands = m_deferredIslands.size();
+    stats.generatingIslands = m_generatingIslands.size();
+    m_streamingStats = stats;
+    
+    PROFILE_COUNTER("Chunks hot", stats.residentChunks);
+    PROFILE_COUNTER("Chunks cold", stats.coldChunks);
+    PROFILE_COUNTER("Chunk bytes hot", stats.hotBytes);
+    PROFILE_COUNTER("Chunk bytes cold", stats.coldBytes);
+    
+    if (tiersMoved)
+    {
+        std::cout << "🛰️  Streaming: " << stats.loadedChunks << " chunks paged in, " << stats.compactedChunks
+                  << " compacted, " << stats.rehydratedChunks << " rehydrated, " << stats.evictedChunks << " evicted, "
+                  << stats.generatedIslands << " islands generated (" << stats.residentChunks << " hot / "
+                  << stats.hotBytes / 1024 << " KB, " << stats.coldChunks << " cold / " << stats.coldBytes / 1024
+                  << " KB, " << stats.generatingIslands << " islands generating, " << stats.deferredIslands
+                  << " not generated yet)" << std::endl;
+    }
+}
@@ -1,58 +1,123 @@
 // IslandChunkSystem.h - Floating island chunking system
 #pragma once
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <unordered_map>
-#include <map>
+#include <unordered_set>
 #include <vector>
+#include <algorithm>
 #include <cmath>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include "../Math/Vec3.h"
 #include "VoxelChunk.h"
 #include "BlockType.h"
+#include "ChunkCoord.h"
+#include "IslandBroadphase.h"
+#include "IslandConnectivity.h"
+#include "../Core/JobSystem.h"
+
+// A chunk compacted out of memory (IslandChunkSystem cold tier): its voxels as one LZ4 block
+// (VoxelCompression, VOLUME bytes x fastest) - no mesh, collision, light maps or neighbor links
+struct ColdChunk
+{
+    std::vector<uint8_t> compressed;
+    bool unsavedChanges = false;  // The hot chunk had writes the world save hasn't seen yet
+    float idleSeconds = 0.0f;     // Carried over from the hot chunk, advanced while cold
+    uint64_t voxelVersion = 0;    // The hot chunk's VoxelChunk::getVoxelVersion - these bytes, unchanged
+};
 
 // An Island is a collection of chunks that move together as one physics body
 struct FloatingIsland
 {
-    Vec3 physicsCenter{0, 0, 0};                                     // Center of mass for physics
     Vec3 velocity{0, 0, 0};                                          // Island velocity for physics simulation
     Vec3 acceleration{0, 0, 0};                                      // Island acceleration (gravity, wind, etc.)
-    Vec3 rotation{0, 0, 0};                                          // Euler angles (pitch, yaw, roll) in radians
     Vec3 angularVelocity{0, 0, 0};                                   // Rotation speed (radians per second)
-    std::map<Vec3, std::unique_ptr<VoxelChunk>> chunks;              // Multi-chunk support: chunkCoord -> VoxelChunk
+    ChunkCoordMap<std::unique_ptr<VoxelChunk>> chunks;               // Multi-chunk support: chunkCoord -> VoxelChunk (flat hash)
+    ChunkCoordMap<std::unique_ptr<ColdChunk>> coldChunks;            // Compacted chunks (never also in `chunks`)
     uint32_t islandID;                                               // Unique island identifier
     bool needsPhysicsUpdate = false;
     bool isPiloted = false;                                          // Is a player currently piloting this entity?
     uint32_t pilotPlayerID = 0;                                      // Which player is piloting (0 = none)
+    mutable std::shared_mutex mutex;                                 // Guards chunks, cold chunks + pose inside IslandChunkSystem (shared = read)
+    mutable std::unique_ptr<IslandConnectivity> connectivity;        // Split-check graph, built by the first check (voxel-writer thread only)
 
     // Helper functions for chunk coordinate conversion (operates on island-relative coordinates)
-    static Vec3 islandPosToChunkCoord(const Vec3& islandRelativePos) {
-        return Vec3(
-            static_cast<int>(std::floor(islandRelativePos.x / VoxelChunk::SIZE)),
-            static_cast<int>(std::floor(islandRelativePos.y / VoxelChunk::SIZE)),
-            static_cast<int>(std::floor(islandRelativePos.z / VoxelChunk::SIZE))
-        );
+    static ChunkCoord islandPosToChunkCoord(const Vec3& islandRelativePos) {
+        return voxelToChunkCoord(ChunkCoord::fromVec3(islandRelativePos));
     }
 
     static Vec3 islandPosToLocalPos(const Vec3& islandRelativePos) {
-        Vec3 chunkCoord = islandPosToChunkCoord(islandRelativePos);
-        // Proper modulo for negative numbers
-        int x = static_cast<int>(islandRelativePos.x) - (chunkCoord.x * VoxelChunk::SIZE);
-        int y = static_cast<int>(islandRelativePos.y) - (chunkCoord.y * VoxelChunk::SIZE);
-        int z = static_cast<int>(islandRelativePos.z) - (chunkCoord.z * VoxelChunk::SIZE);
-        
-        // Ensure result is always 0-15 for valid chunk-local coordinates
-        if (x < 0) x += VoxelChunk::SIZE;
-        if (y < 0) y += VoxelChunk::SIZE;
-        if (z < 0) z += VoxelChunk::SIZE;
+        ChunkCoord voxel = ChunkCoord::fromVec3(islandRelativePos);
+        ChunkCoord local = voxel - chunkCoordToVoxel(voxelToChunkCoord(voxel));  // Always 0-15, negatives included
+        return local.toVec3();
+    }
+
+    // Integer forms - island-relative voxel <-> chunk coordinate, no float math
+    static ChunkCoord voxelToChunkCoord(const ChunkCoord& voxel) {
+        return ChunkCoord(ChunkCoord::floorDiv(voxel.x, VoxelChunk::SIZE),
+                          ChunkCoord::floorDiv(voxel.y, VoxelChunk::SIZE),
+                          ChunkCoord::floorDiv(voxel.z, VoxelChunk::SIZE));
+    }
+
+    static ChunkCoord chunkCoordToVoxel(const ChunkCoord& chunkCoord) {
+        return ChunkCoord(chunkCoord.x * VoxelChunk::SIZE, chunkCoord.y * VoxelChunk::SIZE,
+                          chunkCoord.z * VoxelChunk::SIZE);
+    }
+
+    // Chunk at a chunk coordinate, or null
+    VoxelChunk* findChunk(const ChunkCoord& chunkCoord) const {
+        auto it = chunks.find(chunkCoord);
+        return it != chunks.end() ? it->second.get() : nullptr;
+    }
+
+    // Island-local box around every chunk the island has held - only ever grows, so it stays a
+    // conservative bound after chunks are removed. True when it grew.
+    bool growChunkBounds(const ChunkCoord& chunkCoord) {
+        if (m_hasChunkBounds && chunkCoord.x >= m_chunkBoundsMin.x && chunkCoord.y >= m_chunkBoundsMin.y &&
+            chunkCoord.z >= m_chunkBoundsMin.z && chunkCoord.x <= m_chunkBoundsMax.x &&
+            chunkCoord.y <= m_chunkBoundsMax.y && chunkCoord.z <= m_chunkBoundsMax.z)
+            return false;
+        if (!m_hasChunkBounds) {
+            m_chunkBoundsMin = m_chunkBoundsMax = chunkCoord;
+            m_hasChunkBounds = true;
+            return true;
+        }
+        m_chunkBoundsMin = ChunkCoord(std::min(m_chunkBoundsMin.x, chunkCoord.x), std::min(m_chunkBoundsMin.y, chunkCoord.y),
+                                      std::min(m_chunkBoundsMin.z, chunkCoord.z));
+        m_chunkBoundsMax = ChunkCoord(std::max(m_chunkBoundsMax.x, chunkCoord.x), std::max(m_chunkBoundsMax.y, chunkCoord.y),
+                                      std::max(m_chunkBoundsMax.z, chunkCoord.z));
+        return true;
+    }
+
+    // World-space AABB of the chunk bounds under the current pose; false until the island has a chunk
+    bool getWorldBounds(Vec3& outMin, Vec3& outMax) const {
+        if (!m_hasChunkBounds)
+            return false;
+        const Vec3 localMin = chunkCoordToWorldPos(m_chunkBoundsMin);
+        const Vec3 localMax = chunkCoordToWorldPos(m_chunkBoundsMax + ChunkCoord(1, 1, 1));
+        const glm::vec3 halfExtent(0.5f * (localMax.x - localMin.x), 0.5f * (localMax.y - localMin.y),
+                                   0.5f * (localMax.z - localMin.z));
+        const Vec3 center = localToWorld((localMin + localMax) * 0.5f);
         
-        return Vec3(x, y, z);
+        // Rotated box -> axis-aligned: each world axis takes |rotation| x the local half extents
+        const glm::mat3 rotation(m_transform);
+        Vec3 extent;
+        extent.x = std::abs(rotation[0][0]) * halfExtent.x + std::abs(rotation[1][0]) * halfExtent.y + std::abs(rotation[2][0]) * halfExtent.z;
+        extent.y = std::abs(rotation[0][1]) * halfExtent.x + std::abs(rotation[1][1]) * halfExtent.y + std::abs(rotation[2][1]) * halfExtent.z;
+        extent.z = std::abs(rotation[0][2]) * halfExtent.x + std::abs(rotation[1][2]) * halfExtent.y + std::abs(rotation[2][2]) * halfExtent.z;
+        outMin = center - extent;
+        outMax = center + extent;
+        return true;
     }
 
-    static Vec3 chunkCoordToWorldPos(const Vec3& chunkCoord) {
+    static Vec3 chunkCoordToWorldPos(const ChunkCoord& chunkCoord) {
         return Vec3(
             chunkCoord.x * VoxelChunk::SIZE,
             chunkCoord.y * VoxelChunk::SIZE,
@@ -60,56 +125,112 @@ struct FloatingIsland
         );
     }
     
+    // Move/rotate the island. The cached transform is rebuilt only when the pose actually changes,
+    // so every reader below is a plain lookup (no glm::rotate / glm::inverse per call).
+    void setPose(const Vec3& center, const Vec3& eulerRotation) {
+        if (center == m_physicsCenter && eulerRotation == m_rotation)
+            return;
+        m_physicsCenter = center;
+        m_rotation = eulerRotation;
+        rebuildTransformCache();
+        needsPhysicsUpdate = true;
+    }
+    void setPhysicsCenter(const Vec3& center) { setPose(center, m_rotation); }
+    void setRotation(const Vec3& eulerRotation) { setPose(m_physicsCenter, eulerRotation); }
+    
+    // Center of mass for physics, and Euler angles (pitch, yaw, roll) in radians - written only
+    // through the setters above so the cached transform never goes stale
+    const Vec3& getPhysicsCenter() const { return m_physicsCenter; }
+    const Vec3& getRotation() const { return m_rotation; }
+    
+    // Bumped on every pose change - lets callers keep their own derived data keyed on it
+    uint64_t getTransformVersion() const { return m_transformVersion; }
+    
+    // Rotation as a quaternion (yaw * pitch * roll) and translation - the rigid transform itself
+    const glm::quat& getOrientation() const { return m_orientation; }
+    
     // Get the complete transformation matrix for this island (position + rotation)
     // This is the single source of truth for how island-space transforms to world-space
-    glm::mat4 getTransformMatrix() const {
-        glm::mat4 transform = glm::mat4(1.0f);
-        
-        // Apply translation (position)
-        transform = glm::translate(transform, glm::vec3(physicsCenter.x, physicsCenter.y, physicsCenter.z));
-        
-        // Apply rotation (Euler angles: yaw, pitch, roll)
-        // Order matters: Y (yaw) -> X (pitch) -> Z (roll) for typical ship-like rotation
-        transform = glm::rotate(transform, rotation.y, glm::vec3(0.0f, 1.0f, 0.0f)); // Yaw
-        transform = glm::rotate(transform, rotation.x, glm::vec3(1.0f, 0.0f, 0.0f)); // Pitch
-        transform = glm::rotate(transform, rotation.z, glm::vec3(0.0f, 0.0f, 1.0f)); // Roll
-        
-        return transform;
-    }
+    const glm::mat4& getTransformMatrix() const { return m_transform; }
     
     // Get the inverse transform matrix (world-space → island-local space)
     // Used for raycasting and collision detection against rotated islands
-    glm::mat4 getInverseTransformMatrix() const {
-        return glm::inverse(getTransformMatrix());
-    }
+    const glm::mat4& getInverseTransformMatrix() const { return m_inverseTransform; }
     
     // Transform a world-space position to island-local space
     Vec3 worldToLocal(const Vec3& worldPos) const {
-        glm::vec4 worldPoint(worldPos.x, worldPos.y, worldPos.z, 1.0f);
-        glm::vec4 localPoint = getInverseTransformMatrix() * worldPoint;
+        glm::vec4 localPoint = m_inverseTransform * glm::vec4(worldPos.x, worldPos.y, worldPos.z, 1.0f);
         return Vec3(localPoint.x, localPoint.y, localPoint.z);
     }
     
     // Transform a world-space direction (no translation) to island-local space
     Vec3 worldDirToLocal(const Vec3& worldDir) const {
-        glm::vec4 worldDirection(worldDir.x, worldDir.y, worldDir.z, 0.0f); // w=0 for direction
-        glm::vec4 localDirection = getInverseTransformMatrix() * worldDirection;
+        glm::vec3 localDirection = glm::mat3(m_inverseTransform) * glm::vec3(worldDir.x, worldDir.y, worldDir.z);
         return Vec3(localDirection.x, localDirection.y, localDirection.z);
     }
     
     // Transform an island-local position to world space
     Vec3 localToWorld(const Vec3& localPos) const {
-        glm::vec4 localPoint(localPos.x, localPos.y, localPos.z, 1.0f);
-        glm::vec4 worldPoint = getTransformMatrix() * localPoint;
+        glm::vec4 worldPoint = m_transform * glm::vec4(localPos.x, localPos.y, localPos.z, 1.0f);
         return Vec3(worldPoint.x, worldPoint.y, worldPoint.z);
     }
     
     // Transform an island-local direction to world space
     Vec3 localDirToWorld(const Vec3& localDir) const {
-        glm::vec4 localDirection(localDir.x, localDir.y, localDir.z, 0.0f); // w=0 for direction
-        glm::vec4 worldDirection = getTransformMatrix() * localDirection;
+        glm::vec3 worldDirection = glm::mat3(m_transform) * glm::vec3(localDir.x, localDir.y, localDir.z);
         return Vec3(worldDirection.x, worldDirection.y, worldDirection.z);
     }
+    
+    // Batch versions - one cached matrix for the whole span (in and out may alias)
+    void worldToLocal(const Vec3* worldPositions, Vec3* localPositions, size_t count) const {
+        transformPoints(m_inverseTransform, worldPositions, localPositions, count);
+    }
+    void localToWorld(const Vec3* localPositions, Vec3* worldPositions, size_t count) const {
+        transformPoints(m_transform, localPositions, worldPositions, count);
+    }
+
+private:
+    void rebuildTransformCache() {
+        // Order matters: Y (yaw) -> X (pitch) -> Z (roll) for typical ship-like rotation
+        m_orientation = glm::angleAxis(m_rotation.y, glm::vec3(0.0f, 1.0f, 0.0f)) *
+                        glm::angleAxis(m_rotation.x, glm::vec3(1.0f, 0.0f, 0.0f)) *
+                        glm::angleAxis(m_rotation.z, glm::vec3(0.0f, 0.0f, 1.0f));
+        
+        const glm::mat3 rotationMatrix = glm::mat3_cast(m_orientation);
+        const glm::vec3 translation(m_physicsCenter.x, m_physicsCenter.y, m_physicsCenter.z);
+        m_transform = glm::mat4(rotationMatrix);
+        m_transform[3] = glm::vec4(translation, 1.0f);
+        
+        // Rigid transform: inverse is the transposed rotation and the rotated-back translation
+        const glm::mat3 inverseRotation = glm::transpose(rotationMatrix);
+        m_inverseTransform = glm::mat4(inverseRotation);
+        m_inverseTransform[3] = glm::vec4(-(inverseRotation * translation), 1.0f);
+        
+        ++m_transformVersion;
+    }
+    
+    static void transformPoints(const glm::mat4& matrix, const Vec3* in, Vec3* out, size_t count) {
+        const glm::mat3 linear(matrix);
+        const glm::vec3 offset(matrix[3]);
+        for (size_t i = 0; i < count; ++i)
+        {
+            glm::vec3 p = linear * glm::vec3(in[i].x, in[i].y, in[i].z) + offset;
+            out[i] = Vec3(p.x, p.y, p.z);
+        }
+    }
+    
+    Vec3 m_physicsCenter{0, 0, 0};
+    Vec3 m_rotation{0, 0, 0};
+    
+    // Cached rigid transform - identity matches the default pose
+    glm::quat m_orientation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::mat4 m_transform{1.0f};
+    glm::mat4 m_inverseTransform{1.0f};
+    uint64_t m_transformVersion = 0;
+    
+    ChunkCoord m_chunkBoundsMin;
+    ChunkCoord m_chunkBoundsMax;
+    bool m_hasChunkBounds = false;
 };
 
 // A chunk within an island - has LOCAL coordinates relative to island center
@@ -129,6 +250,28 @@ struct IslandChunk
     }
 };
 
+class IslandChunkSystem;
+
+// Backing store the streaming working set pages chunks in from and evicts them to (WorldSave on
+// the server). Only called from the thread that runs updatePlayerChunks.
+class ChunkStreamSource
+{
+   public:
+    virtual ~ChunkStreamSource() = default;
+
+    // Attach whichever of these chunks the source holds and the island lacks; returns how many were attached
+    virtual size_t loadChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords) = 0;
+
+    // Take these cold chunks off the island (dropColdChunks) without losing their contents; returns
+    // how many were evicted
+    virtual size_t evictChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords) = 0;
+
+    // A chunk the source holds for the island but hasn't attached - evicted or never paged in
+    virtual bool hasStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord) const = 0;
+    // Its voxels (VOLUME bytes), without attaching it; false when there is no such chunk
+    virtual bool readStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord, uint8_t* voxels) const = 0;
+};
+
 // This system manages islands that can move through space
 class IslandChunkSystem
 {
@@ -144,9 +287,9 @@ class IslandChunkSystem
     const FloatingIsland* getIsland(uint32_t islandID) const;
 
     // Chunk management within islands
-    void addChunkToIsland(uint32_t islandID, const Vec3& chunkCoord);
-    void removeChunkFromIsland(uint32_t islandID, const Vec3& chunkCoord);
-    VoxelChunk* getChunkFromIsland(uint32_t islandID, const Vec3& chunkCoord);
+    void addChunkToIsland(uint32_t islandID, const ChunkCoord& chunkCoord);
+    void removeChunkFromIsland(uint32_t islandID, const ChunkCoord& chunkCoord);
+    VoxelChunk* getChunkFromIsland(uint32_t islandID, const ChunkCoord& chunkCoord);
 
     // **ISLAND-CENTRIC VOXEL ACCESS** (Only way to access voxels)
     // Uses world coordinates - automatically converts to chunk + local coordinates
@@ -163,24 +306,146 @@ class IslandChunkSystem
     void setBlockIDWithAutoChunk(uint32_t islandID, const Vec3& islandRelativePos, uint8_t blockID);
     uint8_t getBlockIDInIsland(uint32_t islandID, const Vec3& islandRelativePosition) const;
 
+    // Chunk profile for every chunk this system creates (Lean = headless server, collision only)
+    void setChunkProfile(ChunkProfile profile) { m_chunkProfile = profile; }
+    ChunkProfile getChunkProfile() const { return m_chunkProfile; }
+
+    // Deferred remeshing: voxel edits only mark chunks (and touched face neighbors) dirty, and
+    // flushDirtyChunks() remeshes each dirty chunk once. Flushed once per server tick (before
+    // simulation) and once per client frame, from the thread that writes voxels.
+    void markChunkDirty(VoxelChunk* chunk);
+    void flushDirtyChunks();
+
+    // Flush target: background workers (client) or inline (server - physics needs the new
+    // collision before the tick simulates)
+    void setBackgroundMeshing(bool enabled) { m_backgroundMeshing = enabled; }
+
+    struct RemeshStats
+    {
+        uint64_t requested = 0;  // markChunkDirty calls
+        uint64_t executed = 0;   // Remeshes actually issued by flushDirtyChunks
+        uint64_t coalesced() const { return requested - executed; }
+    };
+    RemeshStats getRemeshStats() const;
+
     // Physics integration
     void updateIslandPhysics(float deltaTime);
     void syncPhysicsToChunks();  // Update chunk world positions from physics
 
-    // Player-relative chunk loading (for infinite worlds)
-    void updatePlayerChunks(const Vec3& playerPosition);
+    // **INTEREST-BASED STREAMING** (server tick thread only)
+    // The working set is every chunk within the render distance (in chunks, measured in each island's
+    // local space) of any player. updatePlayerChunks starts generating deferred islands that came in
+    // range, attaches the ones that finished (all cold), and moves chunks between three residency tiers:
+    //   hot  - a full VoxelChunk (mesh, collision); every working-set chunk is hot
+    //   cold - LZ4 voxel bytes only (ColdChunk). Chunks further than render distance +
+    //          EVICTION_MARGIN from every player go cold at once, chunks in the margin band once
+    //          nothing wrote to them for COLD_AFTER_SECONDS (the margin keeps a player walking along
+    //          the border from thrashing). Cold chunks back in the working set are rehydrated.
+    //   disk - cold chunks past the margin and idle for EVICT_AFTER_SECONDS go to the stream
+    //          source; missing working-set chunks are paged back in from it. Without a stream
+    //          source chunks stay cold.
+    void updatePlayerChunks(const std::vector<Vec3>& playerPositions);
+    void updatePlayerChunks(const Vec3& playerPosition) { updatePlayerChunks(std::vector<Vec3>{playerPosition}); }
     void setRenderDistance(int chunks)
     {
         m_renderDistance = chunks;
     }
+    int getRenderDistance() const { return m_renderDistance; }
+    void setStreamSource(ChunkStreamSource* source) { m_streamSource = source; }
+    ChunkStreamSource* getStreamSource() const { return m_streamSource; }
+
+    // The island exists (pose, physics, saves) but stays empty until a player comes near it
+    void deferIslandGeneration(uint32_t islandID, uint32_t seed, float radius);
+    bool isIslandGenerated(uint32_t islandID) const;  // False while still generating too
+    bool getDeferredGeneration(uint32_t islandID, uint32_t& outSeed, float& outRadius) const;
+
+    // Start generating every deferred island whose bounds come within render distance of a world
+    // position (one background job per island, biggest first); returns how many were started.
+    // Nothing is attached until attachGeneratedIslands picks the result up.
+    size_t generateChunksAroundPoint(const Vec3& center);
+    // Attach finished generations as cold chunks - the streaming update wakes the working set, the
+    // rest of the island never goes hot. waitForAll blocks for the running ones (world startup).
+    // Returns how many islands were attached.
+    size_t attachGeneratedIslands(bool waitForAll = false);
+
+    // Loaded chunks of every island within render distance of a world position. The pointers stay
+    // valid until the calling thread next adds or removes chunks.
+    struct ChunkInRange
+    {
+        uint32_t islandID;
+        ChunkCoord chunkCoord;
+        VoxelChunk* chunk;
+    };
+    void getChunksInRange(const Vec3& worldPosition, std::vector<ChunkInRange>& outChunks) const;
+
+    struct StreamingStats
+    {
+        size_t residentChunks = 0;    // Hot after the last update
+        size_t coldChunks = 0;        // Cold after the last update
+        size_t hotBytes = 0;          // Estimated heap + object bytes of the hot chunks
+        size_t coldBytes = 0;         // Compressed bytes of the cold chunks
+        size_t loadedChunks = 0;      // Paged in by the last update
+        size_t compactedChunks = 0;   // Made cold by the last update
+        size_t rehydratedChunks = 0;  // Made hot again since the previous update (on access included)
+        size_t evictedChunks = 0;     // Handed to the stream source by the last update
+        size_t generatedIslands = 0;   // Deferred islands attached by the last update
+        size_t generatingIslands = 0;  // On the job system
+        size_t deferredIslands = 0;    // Still waiting for a player
+    };
+    const StreamingStats& getStreamingStats() const { return m_streamingStats; }
+
+    // **COLD TIER** - chunk accessors rehydrate transparently: getChunkFromIsland, setVoxel*, a
+    // write-mode VoxelAccessor and addChunkToIsland bring a cold chunk back (remeshed at the next
+    // flush), getVoxelFromIsland reads straight from the compressed bytes. A read-only VoxelAccessor
+    // and getIslands() see hot chunks only - rehydrate the island first when the whole of it matters.
+    // Compaction and batch rehydration must run on the thread that writes voxels.
+    size_t compactChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);    // Hot -> cold
+    size_t rehydrateChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);  // Cold -> hot, meshed
+    size_t rehydrateIsland(uint32_t islandID);
+    // Cold or stored (stream source) -> hot, meshed; returns how many came back
+    size_t wakeChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);
+    // Forget cold chunks the stream source has stored; returns how many were dropped
+    size_t dropColdChunks(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);
+    bool isChunkCold(uint32_t islandID, const ChunkCoord& chunkCoord) const;
+    static bool decodeColdChunk(const ColdChunk& cold, uint8_t* voxels);  // VOLUME bytes
+
+    // **BROADPHASE** - islands whose world bounds may touch a box or a ray segment (conservative,
+    // each ID once). Kept current as islands gain chunks and by updateIslandPhysics, so a pose set
+    // directly on an island (network sync, world load) is picked up by the next physics update.
+    // Chunks an island has only on disk count once reported through growIslandBounds.
+    void growIslandBounds(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);
+    void queryIslandsInBox(const Vec3& worldMin, const Vec3& worldMax, std::vector<uint32_t>& outIslandIDs) const;
+    void queryIslandsAlongRay(const Vec3& origin, const Vec3& direction, float maxDistance,
+                              std::vector<uint32_t>& outIslandIDs) const;  // direction normalized
 
     // Rendering interface
     void getAllChunks(std::vector<VoxelChunk*>& outChunks);
     void getVisibleChunks(const Vec3& viewPosition, std::vector<VoxelChunk*>& outChunks);
 
-    // **ORGANIC ISLAND GENERATION** (Creates chunks dynamically based on island shape)
-    // This is now the primary and only island generation method
-    void generateFloatingIslandOrganic(uint32_t islandID, uint32_t seed, float radius = 48.0f);
+    // Attach chunks built off-island (island context + neighbor links set here) under one exclusive
+    // island lock. Coordinates the island already has are skipped. Returns how many were attached.
+    size_t attachChunksToIsland(uint32_t islandID, std::vector<std::pair<ChunkCoord, std::unique_ptr<VoxelChunk>>>& chunks);
+    
+    // Mesh + collision for freshly attached chunks (one job each, blocks until done). Attached
+    // neighbors outside the batch are marked dirty.
+    void meshAttachedChunks(uint32_t islandID, const std::vector<std::pair<ChunkCoord, VoxelChunk*>>& chunks);
+    
+    // Take chunks off an island under one exclusive island lock and hand them back (the reverse of
+    // attachChunksToIsland). Coordinates the island doesn't have are skipped. Neighbors keep their
+    // meshes - the faces toward a detached chunk stay culled until it comes back.
+    size_t detachChunksFromIsland(uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords,
+                                  std::vector<std::unique_ptr<VoxelChunk>>& outChunks);
+
+    // **BULK SPLIT** - Move voxels out of an island into a new one, a whole chunk payload at a time.
+    // fragmentVoxels holds VOLUME bytes per source chunk: solid voxels move (with their type), air
+    // stays. New-island chunk c receives source chunk c + chunkOffset, and the new island takes the
+    // source's rotation, velocity and angular velocity, centered at local chunkOffset * SIZE in the
+    // source's frame, so every voxel keeps its world position. Each touched
+    // chunk and exposed neighbor is remeshed once, at the next flush. Returns the new island's ID
+    // (forceIslandID as in createIsland), 0 if the source island doesn't exist.
+    uint32_t splitChunksToNewIsland(uint32_t sourceIslandID, const std::vector<ChunkCoord>& sourceChunkCoords,
+                                    const uint8_t* fragmentVoxels, const ChunkCoord& chunkOffset,
+                                    uint32_t forceIslandID = 0);
 
     // Island queries
     Vec3 getIslandCenter(uint32_t islandID) const;    // Get current physics center of island
@@ -188,13 +453,78 @@ class IslandChunkSystem
     const std::unordered_map<uint32_t, FloatingIsland>& getIslands() const { return m_islands; }
 
    private:
+    friend class VoxelAccessor;  // Pins an island under these same locks for batched access
+
+    // Two-level locking, always taken table -> island:
+    //   m_islandsMutex     - the island table: shared for any lookup, exclusive only to create/destroy islands
+    //   FloatingIsland::mutex - one island's chunk map and pose: shared for reads, exclusive to add/remove
+    //                        chunks or move the island (other islands stay readable and writable)
+    // Voxel writes into an existing chunk happen outside both (the chunk owns its storage).
     std::unordered_map<uint32_t, FloatingIsland> m_islands;
     uint32_t m_nextIslandID = 1;
     int m_renderDistance = 8;
-    mutable std::mutex m_islandsMutex;
+    static constexpr int EVICTION_MARGIN = 2;  // Chunks past the render distance before eviction
+    static constexpr float COLD_AFTER_SECONDS = 30.0f;   // Idle time before a margin-band chunk goes cold
+    static constexpr float EVICT_AFTER_SECONDS = 120.0f;  // Idle time before a cold chunk goes to disk
+    ChunkProfile m_chunkProfile = ChunkProfile::Full;
+    bool m_backgroundMeshing = false;
+    mutable std::shared_mutex m_islandsMutex;
+    
+    // Table lookup - caller holds m_islandsMutex (either mode)
+    FloatingIsland* findIsland(uint32_t islandID);
+    const FloatingIsland* findIsland(uint32_t islandID) const;
+    // Existing chunk under a shared island lock, else create + link it under an exclusive one
+    // (caller holds m_islandsMutex, not the island mutex)
+    VoxelChunk* getOrCreateChunk(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord, bool& outCreated);
+    // Create + link a chunk that isn't hot yet - rehydrated if it is cold (caller holds the island mutex exclusively)
+    VoxelChunk* createChunkLocked(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord);
+    // Cold chunk back to hot in place, queued for a remesh; null if not cold (island mutex held exclusively)
+    VoxelChunk* rehydrateChunkLocked(FloatingIsland& island, uint32_t islandID, const ChunkCoord& chunkCoord);
+
+    // World-space island bounds (innermost lock - taken after any island lock, never before one)
+    IslandBroadphase m_broadphase;
+    mutable std::shared_mutex m_broadphaseMutex;
+    void updateBroadphase(const FloatingIsland& island);  // Caller holds the island mutex (either mode)
+
+    // Chunks awaiting a remesh at the next flush (entries removed when a chunk is destroyed)
+    std::unordered_set<VoxelChunk*> m_dirtyChunks;
+    RemeshStats m_remeshStats;
+    mutable std::mutex m_dirtyMutex;
+    void forgetDirtyChunk(VoxelChunk* chunk);
+    void remeshChunk(VoxelChunk* chunk);
+
+    // Streaming state (server tick thread only)
+    struct DeferredIsland
+    {
+        uint32_t seed = 0;
+        float radius = 0.0f;
+        float boundingRadius = 0.0f;  // Island-local sphere every generated voxel falls inside
+    };
+    std::unordered_map<uint32_t, DeferredIsland> m_deferredIslands;
+    std::unordered_map<uint32_t, float> m_unwatchedSeconds;  // Islands out of every player's reach, for how long
+    
+    // **ORGANIC ISLAND GENERATION** (Creates chunks dynamically based on island shape)
+    // Chunks are filled in parallel per-chunk tasks on a private staging island, cleaned of
+    // satellites, decorated and handed back compressed. Touches no system state - runs on any thread.
+    using GeneratedChunks = std::vector<std::pair<ChunkCoord, std::unique_ptr<ColdChunk>>>;
+    static void generateFloatingIslandOrganic(uint32_t islandID, uint32_t seed, float radius, ChunkProfile profile,
+                                              GeneratedChunks& outChunks);
+    struct GeneratingIsland
+    {
+        uint32_t islandID;
+        DeferredIsland params;                    // Still reported as deferred (world save) until attached
+        JobSystem::JobHandle job;
+        std::shared_ptr<GeneratedChunks> result;  // Shared with the job - outlives a destroyed island
+    };
+    std::vector<GeneratingIsland> m_generatingIslands;  // Tick thread only
+    ChunkStreamSource* m_streamSource = nullptr;
+    StreamingStats m_streamingStats;
+    std::chrono::steady_clock::time_point m_lastStreamingUpdate{};
+    std::atomic<size_t> m_rehydratedChunks{0};  // Since the last update - accessors rehydrate from any thread
 
-    // Generate chunks around a center point (for infinite worlds)
-    void generateChunksAroundPoint(const Vec3& center);
+    // Chunk neighbor links for lock-free meshing (island mutex must be held exclusively)
+    static void linkChunkNeighbors(FloatingIsland& island, const ChunkCoord& chunkCoord, VoxelChunk* chunk);
+    static void unlinkChunkNeighbors(FloatingIsland& island, const ChunkCoord& chunkCoord);
 };
 
 // Global island system
@@ -0,0 +1,367 @@
+// IslandConnectivity.cpp - Persistent chunk-level connectivity graph of one island
+#include "IslandConnectivity.h"
+
+#include <algorithm>
+
+#include "IslandChunkSystem.h"
+#include "VoxelChunk.h"
+
+namespace
+{
+constexpr int CHUNK_SIZE = VoxelChunk::SIZE;
+constexpr int CHUNK_VOLUME = VoxelChunk::VOLUME;
+constexpr int CHUNK_ROWS = CHUNK_SIZE * CHUNK_SIZE;  // One 16-bit x row per (y, z)
+constexpr int AXIS_STRIDE[3] = {1, CHUNK_SIZE, CHUNK_SIZE * CHUNK_SIZE};
+
+// Face order matches VoxelChunk neighbors (0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X); opposite = face ^ 1
+constexpr int FACE_AXIS[6] = {1, 1, 2, 2, 0, 0};
+const ChunkCoord FACE_STEP[6] = {ChunkCoord(0, -1, 0), ChunkCoord(0, 1, 0), ChunkCoord(0, 0, -1),
+                                 ChunkCoord(0, 0, 1),  ChunkCoord(-1, 0, 0), ChunkCoord(1, 0, 0)};
+
+// Voxel index of a face cell. Cells run along the face's other two axes, so the two chunks sharing
+// a face list its voxel pairs in the same order.
+int faceVoxelIndex(int face, int cell)
+{
+    const int axis = FACE_AXIS[face];
+    const int side = (face & 1) ? CHUNK_SIZE - 1 : 0;
+    return side * AXIS_STRIDE[axis] + (cell % CHUNK_SIZE) * AXIS_STRIDE[(axis + 1) % 3] +
+           (cell / CHUNK_SIZE) * AXIS_STRIDE[(axis + 2) % 3];
+}
+
+ChunkCoord voxelOfIndex(int index)
+{
+    return ChunkCoord(index % CHUNK_SIZE, (index / CHUNK_SIZE) % CHUNK_SIZE, index / CHUNK_ROWS);
+}
+}  // namespace
+
+uint16_t IslandConnectivity::labelChunk(const uint8_t* voxels, uint16_t* labels)
+{
+    uint16_t rows[CHUNK_ROWS];
+    for (int row = 0; row < CHUNK_ROWS; ++row)
+    {
+        const uint8_t* rowVoxels = voxels + row * CHUNK_SIZE;
+        uint16_t bits = 0;
+        for (int x = 0; x < CHUNK_SIZE; ++x)
+            bits |= static_cast<uint16_t>(rowVoxels[x] != 0) << x;
+        rows[row] = bits;
+    }
+    std::fill(labels, labels + CHUNK_VOLUME, uint16_t(0));
+
+    auto isOpen = [&](int index) { return labels[index] == 0 && ((rows[index >> 4] >> (index & 15)) & 1); };
+
+    uint16_t stack[CHUNK_VOLUME];  // Each voxel is pushed at most once
+    uint16_t labelCount = 0;
+    for (int seed = 0; seed < CHUNK_VOLUME; ++seed)
+    {
+        if (!isOpen(seed))
+            continue;
+
+        const uint16_t label = ++labelCount;
+        int top = 0;
+        labels[seed] = label;
+        stack[top++] = static_cast<uint16_t>(seed);
+        while (top > 0)
+        {
+            const int index = stack[--top];
+            auto visit = [&](int neighbor)
+            {
+                if (!isOpen(neighbor))
+                    return;
+                labels[neighbor] = label;
+                stack[top++] = static_cast<uint16_t>(neighbor);
+            };
+
+            const int x = index & 15;
+            const int y = (index >> 4) & 15;
+            const int z = index >> 8;
+            if (x > 0) visit(index - AXIS_STRIDE[0]);
+            if (x < CHUNK_SIZE - 1) visit(index + AXIS_STRIDE[0]);
+            if (y > 0) visit(index - AXIS_STRIDE[1]);
+            if (y < CHUNK_SIZE - 1) visit(index + AXIS_STRIDE[1]);
+            if (z > 0) visit(index - AXIS_STRIDE[2]);
+            if (z < CHUNK_SIZE - 1) visit(index + AXIS_STRIDE[2]);
+        }
+    }
+    return labelCount;
+}
+
+void IslandConnectivity::ChunkEntry::assign(const uint16_t* labels, uint16_t count)
+{
+    labelCount = count;
+    labelVoxels.assign(count, 0);
+    labelSeed.assign(count, 0);
+    labelMark.assign(count, 0);
+    labelTarget.assign(count, 0);
+    for (int index = 0; index < CHUNK_VOLUME; ++index)
+    {
+        if (labels[index] == 0)
+            continue;
+        if (labelVoxels[labels[index] - 1]++ == 0)
+            labelSeed[labels[index] - 1] = static_cast<uint16_t>(index);
+    }
+    for (int face = 0; face < 6; ++face)
+    {
+        for (int cell = 0; cell < FACE_CELLS; ++cell)
+            faceLabels[face][cell] = labels[faceVoxelIndex(face, cell)];
+    }
+}
+
+void IslandConnectivity::clear()
+{
+    m_chunks.clear();
+    m_targets.clear();
+    m_queue.clear();
+    m_scratchActive = false;
+}
+
+void IslandConnectivity::chunkStored(const ChunkCoord& chunkCoord, uint64_t voxelVersion)
+{
+    auto it = m_chunks.find(chunkCoord);
+    if (it == m_chunks.end())
+        return;
+    if (it->second->version == voxelVersion)
+        it->second->version = STORED_VERSION;
+    else
+        m_chunks.erase(it);
+}
+
+bool IslandConnectivity::readVoxels(const FloatingIsland& island, const ChunkCoord& chunkCoord, uint8_t* voxels) const
+{
+    if (const VoxelChunk* chunk = island.findChunk(chunkCoord))
+    {
+        chunk->copyRawVoxelData(voxels);
+        return true;
+    }
+    auto coldIt = island.coldChunks.find(chunkCoord);
+    if (coldIt != island.coldChunks.end())
+        return IslandChunkSystem::decodeColdChunk(*coldIt->second, voxels);
+    return m_source && m_source->readStoredChunk(island.islandID, chunkCoord, voxels);
+}
+
+IslandConnectivity::ChunkEntry* IslandConnectivity::entryFor(const FloatingIsland& island, const ChunkCoord& chunkCoord)
+{
+    if (m_scratchActive && chunkCoord == m_scratchCoord)
+        return &m_scratch;
+
+    // The voxels the labels must match: hot, else cold, else stored (a version that never changes)
+    uint64_t version = STORED_VERSION;
+    if (const VoxelChunk* chunk = island.findChunk(chunkCoord))
+    {
+        version = chunk->getVoxelVersion();
+    }
+    else
+    {
+        auto coldIt = island.coldChunks.find(chunkCoord);
+        if (coldIt != island.coldChunks.end())
+            version = coldIt->second->voxelVersion;
+        else if (!m_source || !m_source->hasStoredChunk(island.islandID, chunkCoord))
+        {
+            m_chunks.erase(chunkCoord);
+            return nullptr;
+        }
+    }
+
+    auto cached = m_chunks.find(chunkCoord);
+    if (cached != m_chunks.end() && cached->second->version == version)
+        return cached->second.get();
+
+    uint8_t voxels[CHUNK_VOLUME];
+    if (!readVoxels(island, chunkCoord, voxels))
+    {
+        m_chunks.erase(chunkCoord);
+        return nullptr;
+    }
+    std::unique_ptr<ChunkEntry>& entry = m_chunks[chunkCoord];
+    if (!entry)
+        entry = std::make_unique<ChunkEntry>();
+    uint16_t labels[CHUNK_VOLUME];
+    entry->assign(labels, labelChunk(voxels, labels));
+    entry->version = version;
+    return entry.get();
+}
+
+void IslandConnectivity::beginSearch()
+{
+    m_targets.clear();
+    m_targetsLeft = 0;
+    if (++m_epoch != 0)
+        return;
+
+    // Epoch wrapped - forget every mark so none reads as current
+    auto resetMarks = [](ChunkEntry& entry)
+    {
+        std::fill(entry.labelMark.begin(), entry.labelMark.end(), 0u);
+        std::fill(entry.labelTarget.begin(), entry.labelTarget.end(), 0u);
+    };
+    for (auto& [chunkCoord, entry] : m_chunks)
+        resetMarks(*entry);
+    resetMarks(m_scratch);
+    m_epoch = 1;
+}
+
+void IslandConnectivity::addTarget(ChunkEntry& entry, const ChunkCoord& chunkCoord, uint16_t label)
+{
+    if (entry.labelTarget[label - 1] == m_epoch)
+        return;
+    entry.labelTarget[label - 1] = m_epoch;
+    m_targets.push_back({chunkCoord, label});
+    m_targetsLeft++;
+}
+
+uint64_t IslandConnectivity::walkComponent(const FloatingIsland& island, const Node& start, bool stopEarly)
+{
+    m_queue.clear();
+    auto reach = [&](ChunkEntry& entry, const ChunkCoord& chunkCoord, uint16_t label)
+    {
+        if (entry.labelMark[label - 1] == m_epoch)
+            return;
+        entry.labelMark[label - 1] = m_epoch;
+        if (entry.labelTarget[label - 1] == m_epoch)
+            m_targetsLeft--;
+        m_queue.push_back({chunkCoord, label});
+    };
+
+    ChunkEntry* startEntry = entryFor(island, start.chunkCoord);
+    if (!startEntry)
+        return 0;
+    reach(*startEntry, start.chunkCoord, start.label);
+
+    uint64_t voxelCount = 0;
+    for (size_t head = 0; head < m_queue.size(); ++head)
+    {
+        if (stopEarly && m_targetsLeft == 0)
+            break;
+
+        const Node node = m_queue[head];
+        ChunkEntry* entry = entryFor(island, node.chunkCoord);
+        voxelCount += entry->labelVoxels[node.label - 1];
+        for (int face = 0; face < 6; ++face)
+        {
+            const ChunkCoord neighborCoord = node.chunkCoord + FACE_STEP[face];
+            ChunkEntry* neighbor = entryFor(island, neighborCoord);
+            if (!neighbor)
+                continue;
+            const auto& mine = entry->faceLabels[face];
+            const auto& theirs = neighbor->faceLabels[face ^ 1];
+            for (int cell = 0; cell < FACE_CELLS; ++cell)
+            {
+                if (mine[cell] == node.label && theirs[cell] != 0)
+                    reach(*neighbor, neighborCoord, theirs[cell]);
+            }
+        }
+    }
+    return voxelCount;
+}
+
+bool IslandConnectivity::wouldBreakCauseSplit(const FloatingIsland& island, const ChunkStreamSource* source,
+                                              const ChunkCoord& voxel, ChunkCoord& outFragmentAnchor)
+{
+    m_source = source;
+    const bool split = checkBreak(island, voxel, outFragmentAnchor);
+    m_scratchActive = false;
+    m_source = nullptr;
+    return split;
+}
+
+bool IslandConnectivity::gatherComponent(const FloatingIsland& island, const ChunkStreamSource* source,
+                                         const ChunkCoord& voxel, std::vector<Node>& outNodes)
+{
+    outNodes.clear();
+    m_scratchActive = false;
+    m_source = source;
+    const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+
+    // Entries keep face labels only - relabel the chunk for the voxel's own label
+    uint8_t voxels[CHUNK_VOLUME];
+    uint16_t labels[CHUNK_VOLUME];
+    uint16_t label = 0;
+    if (readVoxels(island, chunkCoord, voxels))
+    {
+        labelChunk(voxels, labels);
+        const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+        label = labels[local.x + local.y * AXIS_STRIDE[1] + local.z * AXIS_STRIDE[2]];
+    }
+    if (label != 0)
+    {
+        beginSearch();
+        walkComponent(island, {chunkCoord, label}, false);
+        outNodes = m_queue;
+    }
+    m_source = nullptr;
+    return label != 0;
+}
+
+bool IslandConnectivity::checkBreak(const FloatingIsland& island, const ChunkCoord& voxel, ChunkCoord& outFragmentAnchor)
+{
+    m_scratchActive = false;
+    const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+    const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+    const int brokenIndex = local.x + local.y * AXIS_STRIDE[1] + local.z * AXIS_STRIDE[2];
+
+    uint8_t voxels[CHUNK_VOLUME];
+    if (!readVoxels(island, chunkCoord, voxels) || voxels[brokenIndex] == 0)
+        return false;
+
+    // The chunk before and after the break
+    uint16_t before[CHUNK_VOLUME];
+    uint16_t after[CHUNK_VOLUME];
+    labelChunk(voxels, before);
+    voxels[brokenIndex] = 0;
+    m_scratch.assign(after, labelChunk(voxels, after));
+    m_scratchCoord = chunkCoord;
+    const uint16_t brokenLabel = before[brokenIndex];
+
+    // Targets: the pieces the broken voxel's local component falls into, and every neighbor-chunk
+    // node that component touched. The island stays whole iff they all still reach each other.
+    beginSearch();
+    for (int face = 0; face < 6; ++face)
+    {
+        const ChunkCoord neighborCoord = chunkCoord + FACE_STEP[face];
+        ChunkEntry* neighbor = entryFor(island, neighborCoord);
+        if (!neighbor)
+            continue;
+        for (int cell = 0; cell < FACE_CELLS; ++cell)
+        {
+            const uint16_t neighborLabel = neighbor->faceLabels[face ^ 1][cell];
+            if (neighborLabel != 0 && before[faceVoxelIndex(face, cell)] == brokenLabel)
+                addTarget(*neighbor, neighborCoord, neighborLabel);
+        }
+    }
+    m_scratchActive = true;
+    const size_t firstPiece = m_targets.size();
+    for (int index = 0; index < CHUNK_VOLUME; ++index)
+    {
+        if (before[index] == brokenLabel && after[index] != 0)
+            addTarget(m_scratch, chunkCoord, after[index]);
+    }
+    if (m_targets.size() <= 1)
+        return false;
+
+    // Starting from a piece, a component that stayed whole and kept its face contacts reaches every
+    // target in its own first expansion
+    const Node start = m_targets[firstPiece < m_targets.size() ? firstPiece : 0];
+    const uint64_t startVoxels = walkComponent(island, start, true);
+    if (m_targetsLeft == 0)
+        return false;
+
+    // Split: walk each remaining component and cut off the smallest (on a tie, the start side)
+    uint64_t smallestVoxels = startVoxels;
+    Node smallest = start;
+    for (const Node& target : m_targets)
+    {
+        const ChunkEntry* entry = entryFor(island, target.chunkCoord);
+        if (!entry || entry->labelMark[target.label - 1] == m_epoch)
+            continue;
+        const uint64_t componentVoxels = walkComponent(island, target, false);
+        if (componentVoxels < smallestVoxels)
+        {
+            smallestVoxels = componentVoxels;
+            smallest = target;
+        }
+    }
+
+    const ChunkEntry* fragmentEntry = entryFor(island, smallest.chunkCoord);
+    outFragmentAnchor = FloatingIsland::chunkCoordToVoxel(smallest.chunkCoord) +
+                        voxelOfIndex(fragmentEntry->labelSeed[smallest.label - 1]);
+    return true;
+}
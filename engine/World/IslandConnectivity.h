@@ -0,0 +1,105 @@
+// IslandConnectivity.h - Persistent chunk-level connectivity graph of one island
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ChunkCoord.h"
+
+class ChunkStreamSource;
+struct FloatingIsland;
+class VoxelChunk;
+
+// Each chunk's solid voxels are labelled into 6-connected local components; the graph nodes are
+// (chunk, label) pairs and its edges are solid voxel pairs across a shared chunk face. A chunk keeps
+// only its face labels plus per-label voxel counts, and is relabelled the first time a check touches
+// it after a voxel write (VoxelChunk::getVoxelVersion), so a write costs nothing until it matters.
+//
+// A break relabels the broken voxel's chunk with and without it. If its local component stays one
+// piece and keeps every cross-face edge it had, the island cannot split - the common case, answered
+// from one chunk and its six neighbors. Otherwise the pieces and the old neighbors are searched for
+// over the chunk graph (nodes per chunk, not voxels), and only an actual split walks the components
+// to pick the smaller side.
+//
+// Chunks out of memory are part of the island too: cold ones are labelled from their compressed
+// bytes, stored ones from the stream source, and nothing is paged in to answer a check. Their voxels
+// can't change while they are away, so the labels of a chunk going cold or to disk stay cached.
+//
+// Not thread-safe: owned by the island (FloatingIsland::connectivity) and used by the thread that
+// writes its voxels (the server tick thread).
+class IslandConnectivity
+{
+   public:
+    static constexpr int FACE_CELLS = 16 * 16;
+
+    // A graph node: one local component of one chunk (labels as labelChunk numbers them)
+    struct Node
+    {
+        ChunkCoord chunkCoord;
+        uint16_t label;
+    };
+
+    // Labels the 6-connected solid voxels of one chunk (VOLUME bytes, x fastest) 1..n, 0 = air.
+    // Returns n. Allocation-free: 512-byte occupancy mask, fill stack on the caller's stack.
+    static uint16_t labelChunk(const uint8_t* voxels, uint16_t* labels);
+
+    // Would clearing the island-relative voxel disconnect the island? When it would,
+    // outFragmentAnchor is a voxel of the smallest piece cut off from the largest.
+    // source (may be null) supplies the island's evicted chunks.
+    bool wouldBreakCauseSplit(const FloatingIsland& island, const ChunkStreamSource* source, const ChunkCoord& voxel,
+                              ChunkCoord& outFragmentAnchor);
+
+    // Every node of the component holding the island-relative voxel; false (no nodes) if it's air
+    bool gatherComponent(const FloatingIsland& island, const ChunkStreamSource* source, const ChunkCoord& voxel,
+                         std::vector<Node>& outNodes);
+
+    // A cold chunk is leaving for the stream source: its labels stay valid if they were taken from
+    // these voxels (ColdChunk::voxelVersion)
+    void chunkStored(const ChunkCoord& chunkCoord, uint64_t voxelVersion);
+
+    void clear();
+    size_t getCachedChunkCount() const { return m_chunks.size(); }
+
+   private:
+    // Entry version of a chunk labelled while stored - real voxel versions start at 2^32
+    static constexpr uint64_t STORED_VERSION = 0;
+
+    // One chunk's labelling, reduced to what the graph needs
+    struct ChunkEntry
+    {
+        uint64_t version = STORED_VERSION;  // Voxel version labelled (hot or cold chunk)
+        uint16_t labelCount = 0;
+        std::array<std::array<uint16_t, FACE_CELLS>, 6> faceLabels;  // Face order as VoxelChunk neighbors
+        std::vector<uint32_t> labelVoxels;  // Voxel count per label (index label - 1)
+        std::vector<uint16_t> labelSeed;    // One voxel index per label
+        std::vector<uint32_t> labelMark;    // Search epoch that last reached each label
+        std::vector<uint32_t> labelTarget;  // Search epoch in which each label is a target
+
+        void assign(const uint16_t* labels, uint16_t count);
+    };
+
+    // Current entry for a chunk (relabelled if written since), null when the island has no such chunk.
+    // The chunk under test resolves to its post-break scratch entry.
+    ChunkEntry* entryFor(const FloatingIsland& island, const ChunkCoord& chunkCoord);
+    // A chunk's voxels wherever it lives (hot, cold or stored); false when the island has no such chunk
+    bool readVoxels(const FloatingIsland& island, const ChunkCoord& chunkCoord, uint8_t* voxels) const;
+    bool checkBreak(const FloatingIsland& island, const ChunkCoord& voxel, ChunkCoord& outFragmentAnchor);
+    void beginSearch();
+    void addTarget(ChunkEntry& entry, const ChunkCoord& chunkCoord, uint16_t label);
+    // Breadth-first walk of the start node's component; returns its voxel count. With stopEarly the
+    // walk ends once every target was reached.
+    uint64_t walkComponent(const FloatingIsland& island, const Node& start, bool stopEarly);
+
+    ChunkCoordMap<std::unique_ptr<ChunkEntry>> m_chunks;
+    const ChunkStreamSource* m_source = nullptr;  // For the check in progress
+    ChunkEntry m_scratch;  // The broken voxel's chunk as it would be after the break
+    ChunkCoord m_scratchCoord;
+    bool m_scratchActive = false;
+    uint32_t m_epoch = 0;
+    std::vector<Node> m_targets;  // The broken voxel's pieces and the neighbor nodes it touched
+    size_t m_targetsLeft = 0;     // Targets not yet reached this search
+    std::vector<Node> m_queue;
+};
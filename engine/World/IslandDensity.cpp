@@ -0,0 +1,404 @@
+// IslandDensity.cpp - Batched density evaluation for floating island generation
+#include "IslandDensity.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "VoxelChunk.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_DENSITY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+constexpr int SIZE = VoxelChunk::SIZE;
+constexpr float NOISE_MIX_BOUND = 1.01f;  // Max of vol * 0.6 + terrain * 0.4 (noise in [-1, 1]) plus float slack
+
+#ifdef ENGINE_DENSITY_SSE2
+
+// FastNoiseLite's hashing constants and Gradients3D table - the kernel below mirrors its
+// SinglePerlin / GenFractalFBm operation for operation, so results match bit for bit
+constexpr int PRIME_X = 501125321;
+constexpr int PRIME_Y = 1136930381;
+constexpr int PRIME_Z = 1720413743;
+constexpr int HASH_MULTIPLIER = 0x27d4eb2d;
+
+alignas(16) const float GRADIENTS_3D[256] = {
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    0, 1, 1, 0,  0,-1, 1, 0,  0, 1,-1, 0,  0,-1,-1, 0,
+    1, 0, 1, 0, -1, 0, 1, 0,  1, 0,-1, 0, -1, 0,-1, 0,
+    1, 1, 0, 0, -1, 1, 0, 0,  1,-1, 0, 0, -1,-1, 0, 0,
+    1, 1, 0, 0,  0,-1, 1, 0, -1, 1, 0, 0,  0,-1,-1, 0};
+
+// 32-bit wrapping multiply (SSE2 has no _mm_mullo_epi32)
+inline __m128i mullo32(__m128i a, __m128i b)
+{
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+inline __m128 lerp4(__m128 a, __m128 b, __m128 t) { return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a))); }
+
+// t * t * t * (t * (t * 6 - 15) + 10)
+inline __m128 interpQuintic4(__m128 t)
+{
+    const __m128 t3 = _mm_mul_ps(_mm_mul_ps(t, t), t);
+    const __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))),
+                                    _mm_set1_ps(10.0f));
+    return _mm_mul_ps(t3, inner);
+}
+
+inline __m128 gradCoord4(__m128i seed, __m128i xPrimed, __m128i yPrimed, __m128i zPrimed, __m128 xd, __m128 yd, __m128 zd)
+{
+    __m128i hash = _mm_xor_si128(_mm_xor_si128(seed, xPrimed), _mm_xor_si128(yPrimed, zPrimed));
+    hash = mullo32(hash, _mm_set1_epi32(HASH_MULTIPLIER));
+    hash = _mm_xor_si128(hash, _mm_srai_epi32(hash, 15));
+    hash = _mm_and_si128(hash, _mm_set1_epi32(63 << 2));
+
+    alignas(16) int32_t index[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(index), hash);
+    const __m128 xg = _mm_setr_ps(GRADIENTS_3D[index[0]], GRADIENTS_3D[index[1]], GRADIENTS_3D[index[2]], GRADIENTS_3D[index[3]]);
+    const __m128 yg = _mm_setr_ps(GRADIENTS_3D[index[0] | 1], GRADIENTS_3D[index[1] | 1], GRADIENTS_3D[index[2] | 1],
+                                  GRADIENTS_3D[index[3] | 1]);
+    const __m128 zg = _mm_setr_ps(GRADIENTS_3D[index[0] | 2], GRADIENTS_3D[index[1] | 2], GRADIENTS_3D[index[2] | 2],
+                                  GRADIENTS_3D[index[3] | 2]);
+
+    return _mm_add_ps(_mm_add_ps(_mm_mul_ps(xd, xg), _mm_mul_ps(yd, yg)), _mm_mul_ps(zd, zg));
+}
+
+// FastFloor: f >= 0 ? (int)f : (int)f - 1 (note: -2.0 floors to -3, same as FastNoiseLite)
+inline __m128i fastFloor4(__m128 f)
+{
+    return _mm_add_epi32(_mm_cvttps_epi32(f), _mm_castps_si128(_mm_cmplt_ps(f, _mm_setzero_ps())));
+}
+
+inline __m128 singlePerlin4(int seed, __m128 x, __m128 y, __m128 z)
+{
+    __m128i x0 = fastFloor4(x);
+    __m128i y0 = fastFloor4(y);
+    __m128i z0 = fastFloor4(z);
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 xd0 = _mm_sub_ps(x, _mm_cvtepi32_ps(x0));
+    const __m128 yd0 = _mm_sub_ps(y, _mm_cvtepi32_ps(y0));
+    const __m128 zd0 = _mm_sub_ps(z, _mm_cvtepi32_ps(z0));
+    const __m128 xd1 = _mm_sub_ps(xd0, one);
+    const __m128 yd1 = _mm_sub_ps(yd0, one);
+    const __m128 zd1 = _mm_sub_ps(zd0, one);
+
+    const __m128 xs = interpQuintic4(xd0);
+    const __m128 ys = interpQuintic4(yd0);
+    const __m128 zs = interpQuintic4(zd0);
+
+    x0 = mullo32(x0, _mm_set1_epi32(PRIME_X));
+    y0 = mullo32(y0, _mm_set1_epi32(PRIME_Y));
+    z0 = mullo32(z0, _mm_set1_epi32(PRIME_Z));
+    const __m128i x1 = _mm_add_epi32(x0, _mm_set1_epi32(PRIME_X));
+    const __m128i y1 = _mm_add_epi32(y0, _mm_set1_epi32(PRIME_Y));
+    const __m128i z1 = _mm_add_epi32(z0, _mm_set1_epi32(PRIME_Z));
+
+    const __m128i s = _mm_set1_epi32(seed);
+    const __m128 xf00 = lerp4(gradCoord4(s, x0, y0, z0, xd0, yd0, zd0), gradCoord4(s, x1, y0, z0, xd1, yd0, zd0), xs);
+    const __m128 xf10 = lerp4(gradCoord4(s, x0, y1, z0, xd0, yd1, zd0), gradCoord4(s, x1, y1, z0, xd1, yd1, zd0), xs);
+    const __m128 xf01 = lerp4(gradCoord4(s, x0, y0, z1, xd0, yd0, zd1), gradCoord4(s, x1, y0, z1, xd1, yd0, zd1), xs);
+    const __m128 xf11 = lerp4(gradCoord4(s, x0, y1, z1, xd0, yd1, zd1), gradCoord4(s, x1, y1, z1, xd1, yd1, zd1), xs);
+
+    const __m128 yf0 = lerp4(xf00, xf10, ys);
+    const __m128 yf1 = lerp4(xf01, xf11, ys);
+
+    return _mm_mul_ps(lerp4(yf0, yf1, zs), _mm_set1_ps(0.964921414852142333984375f));
+}
+
+#endif  // ENGINE_DENSITY_SSE2
+
+}  // namespace
+
+IslandDensityField::IslandDensityField(const Settings& settings) : m_settings(settings)
+{
+    m_islandHeight = static_cast<int>(settings.radius * settings.baseHeightRatio);
+    m_searchRadius = static_cast<int>(settings.radius * 1.4f);
+    m_radiusSquared = (settings.radius * 1.4f) * (settings.radius * 1.4f);
+    m_radiusDivisor = 1.0f / (settings.radius * 1.2f);
+
+    m_noise3D.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    m_noise3D.SetSeed(settings.seed);
+    m_noise3D.SetFrequency(settings.noise3DFrequency);
+    m_noise3D.SetFractalType(FastNoiseLite::FractalType_FBm);
+    m_noise3D.SetFractalOctaves(settings.fractalOctaves);
+    m_noise3D.SetFractalLacunarity(2.0f);
+    m_noise3D.SetFractalGain(settings.fractalGain);
+
+    m_noise2D.SetNoiseType(FastNoiseLite::NoiseType_Perlin);
+    m_noise2D.SetSeed(settings.seed + 1000);
+    m_noise2D.SetFrequency(settings.noise2DFrequency);
+    m_noise2D.SetFractalType(FastNoiseLite::FractalType_FBm);
+    m_noise2D.SetFractalOctaves(settings.fractalOctaves);
+    m_noise2D.SetFractalLacunarity(2.0f);
+    m_noise2D.SetFractalGain(settings.fractalGain);
+
+    // Same computation as FastNoiseLite::CalculateFractalBounding
+    const float gain = std::fabs(settings.fractalGain);
+    float amp = gain;
+    float ampFractal = 1.0f;
+    for (int i = 1; i < settings.fractalOctaves; i++)
+    {
+        ampFractal += amp;
+        amp *= gain;
+    }
+    m_fractalBounding = 1 / ampFractal;
+}
+
+float IslandDensityField::verticalDensityAt(int y) const
+{
+    if (y < -m_islandHeight || y > m_islandHeight)
+        return 0.0f;
+
+    float dy = static_cast<float>(y);
+    float islandHeightRange = m_islandHeight * 2.0f;
+    float normalizedY = (dy + m_islandHeight) / islandHeightRange;
+    float centerOffset = normalizedY - 0.5f;
+    float verticalDensity = 1.0f - (centerOffset * centerOffset * 4.0f);
+    return std::max(0.0f, verticalDensity);
+}
+
+bool IslandDensityField::isChunkProvablyEmpty(const ChunkCoord& origin) const
+{
+    // Falloffs only shrink away from the island axis / mid-plane, and float rounding is monotonic,
+    // so the chunk's closest column and best layer bound every voxel in it
+    const float nearX = static_cast<float>(std::clamp(0, origin.x, origin.x + SIZE - 1));
+    const float nearZ = static_cast<float>(std::clamp(0, origin.z, origin.z + SIZE - 1));
+    const float nearDistanceSquared = nearX * nearX + nearZ * nearZ;
+    if (nearDistanceSquared > m_radiusSquared)
+        return true;
+
+    float maxIslandBase = std::max(0.0f, 1.0f - (std::sqrt(nearDistanceSquared) * m_radiusDivisor));
+    maxIslandBase = maxIslandBase * maxIslandBase;
+
+    float maxVerticalDensity = 0.0f;
+    for (int ly = 0; ly < SIZE; ly++)
+        maxVerticalDensity = std::max(maxVerticalDensity, verticalDensityAt(origin.y + ly));
+
+    const float maxBaseDensity = maxIslandBase * maxVerticalDensity;
+    return maxBaseDensity < 0.05f || maxBaseDensity * NOISE_MIX_BOUND <= m_settings.densityThreshold;
+}
+
+void IslandDensityField::noise3DBatch(const float* x, const float* y, const float* z, float* out, int count) const
+{
+#ifdef ENGINE_DENSITY_SSE2
+    const __m128 frequency = _mm_set1_ps(m_settings.noise3DFrequency);
+    const __m128 lacunarity = _mm_set1_ps(2.0f);
+    const __m128 gain = _mm_set1_ps(m_settings.fractalGain);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 weightedStrength = _mm_setzero_ps();  // FastNoiseLite default
+
+    for (int i = 0; i < count; i += 4)
+    {
+        // Pad the tail with zeros - those lanes are computed and dropped
+        alignas(16) float lane[3][4] = {};
+        const int lanes = std::min(4, count - i);
+        for (int l = 0; l < lanes; ++l)
+        {
+            lane[0][l] = x[i + l];
+            lane[1][l] = y[i + l];
+            lane[2][l] = z[i + l];
+        }
+
+        __m128 px = _mm_mul_ps(_mm_load_ps(lane[0]), frequency);
+        __m128 py = _mm_mul_ps(_mm_load_ps(lane[1]), frequency);
+        __m128 pz = _mm_mul_ps(_mm_load_ps(lane[2]), frequency);
+
+        // GenFractalFBm
+        int seed = static_cast<int>(m_settings.seed);
+        __m128 sum = _mm_setzero_ps();
+        __m128 amp = _mm_set1_ps(m_fractalBounding);
+        for (int octave = 0; octave < m_settings.fractalOctaves; octave++)
+        {
+            const __m128 noise = singlePerlin4(seed++, px, py, pz);
+            sum = _mm_add_ps(sum, _mm_mul_ps(noise, amp));
+            amp = _mm_mul_ps(amp, lerp4(one, _mm_mul_ps(_mm_add_ps(noise, one), half), weightedStrength));
+
+            px = _mm_mul_ps(px, lacunarity);
+            py = _mm_mul_ps(py, lacunarity);
+            pz = _mm_mul_ps(pz, lacunarity);
+            amp = _mm_mul_ps(amp, gain);
+        }
+
+        alignas(16) float result[4];
+        _mm_store_ps(result, sum);
+        for (int l = 0; l < lanes; ++l)
+            out[i + l] = result[l];
+    }
+#else
+    for (int i = 0; i < count; ++i)
+        out[i] = m_noise3D.GetNoise(x[i], y[i], z[i]);
+#endif
+}
+
+void IslandDensityField::fillChunk(const ChunkCoord& origin, uint8_t blockID, uint8_t* blockIDs, FillStats& stats) const
+{
+    // Vertical falloff per layer, shared by every column
+    float verticalDensity[SIZE];
+    int activeLayers = 0;
+    for (int ly = 0; ly < SIZE; ly++)
+    {
+        verticalDensity[ly] = verticalDensityAt(origin.y + ly);
+        if (verticalDensity[ly] >= 0.01f)
+            ++activeLayers;
+    }
+    if (activeLayers == 0)
+        return;
+
+    alignas(16) float sampleX[SIZE];
+    alignas(16) float sampleY[SIZE];
+    alignas(16) float sampleZ[SIZE];
+    alignas(16) float volumetric[SIZE];
+    float baseDensity[SIZE];
+    int sampleLayer[SIZE];
+
+    for (int lz = 0; lz < SIZE; lz++)
+    {
+        float dz = static_cast<float>(origin.z + lz);
+
+        for (int lx = 0; lx < SIZE; lx++)
+        {
+            float dx = static_cast<float>(origin.x + lx);
+            stats.voxelsSampled += activeLayers;
+
+            // **SPHERE CULLING** - whole column outside island radius
+            float distanceSquared = dx * dx + dz * dz;
+            if (distanceSquared > m_radiusSquared)
+            {
+                stats.voxelsSkipped += activeLayers;
+                continue;
+            }
+
+            // **RADIAL FALLOFF** - once per column
+            float distanceFromCenter = std::sqrt(distanceSquared);
+            float islandBase = 1.0f - (distanceFromCenter * m_radiusDivisor);
+            islandBase = std::max(0.0f, islandBase);
+            islandBase = islandBase * islandBase;
+            if (islandBase < 0.01f)
+            {
+                stats.earlyRejects += activeLayers;
+                continue;
+            }
+
+            // Gather the layers whose falloff leaves room for noise to pass the threshold
+            int samples = 0;
+            for (int ly = 0; ly < SIZE; ly++)
+            {
+                if (verticalDensity[ly] < 0.01f)
+                    continue;
+                const float base = islandBase * verticalDensity[ly];
+                if (base < 0.05f)
+                {
+                    stats.earlyRejects++;
+                    continue;
+                }
+                sampleX[samples] = dx;
+                sampleY[samples] = static_cast<float>(origin.y + ly);
+                sampleZ[samples] = dz;
+                baseDensity[samples] = base;
+                sampleLayer[samples] = ly;
+                ++samples;
+            }
+            if (samples == 0)
+                continue;
+
+            // **2D PERLIN NOISE** - depends on (x, z) only: once per column
+            float terrainNoise = m_noise2D.GetNoise(dx, dz);
+            terrainNoise = (terrainNoise + 1.0f) * 0.5f;
+
+            // **3D PERLIN NOISE** - the column's samples in one batch
+            noise3DBatch(sampleX, sampleY, sampleZ, volumetric, samples);
+
+            for (int i = 0; i < samples; ++i)
+            {
+                float volumetricNoise = (volumetric[i] + 1.0f) * 0.5f;
+                float finalDensity = baseDensity[i] * (volumetricNoise * 0.6f + terrainNoise * 0.4f);
+                if (finalDensity > m_settings.densityThreshold)
+                {
+                    blockIDs[lx + sampleLayer[i] * SIZE + lz * SIZE * SIZE] = blockID;
+                    stats.voxelsGenerated++;
+                }
+            }
+        }
+    }
+}
+
+void IslandDensityField::fillChunkReference(const ChunkCoord& origin, uint8_t blockID, uint8_t* blockIDs,
+                                            FillStats& stats) const
+{
+    for (int ly = 0; ly < SIZE; ly++)
+    {
+        float dy = static_cast<float>(origin.y + ly);
+        float verticalDensity = verticalDensityAt(origin.y + ly);
+        if (verticalDensity < 0.01f)
+            continue;
+
+        for (int lx = 0; lx < SIZE; lx++)
+        {
+            float dx = static_cast<float>(origin.x + lx);
+            float xSquared = dx * dx;
+
+            for (int lz = 0; lz < SIZE; lz++)
+            {
+                stats.voxelsSampled++;
+                float dz = static_cast<float>(origin.z + lz);
+
+                float distanceSquared = xSquared + dz * dz;
+                if (distanceSquared > m_radiusSquared)
+                {
+                    stats.voxelsSkipped++;
+                    continue;
+                }
+
+                float distanceFromCenter = std::sqrt(distanceSquared);
+                float islandBase = 1.0f - (distanceFromCenter * m_radiusDivisor);
+                islandBase = std::max(0.0f, islandBase);
+                islandBase = islandBase * islandBase;
+                if (islandBase < 0.01f)
+                {
+                    stats.earlyRejects++;
+                    continue;
+                }
+
+                float baseDensity = islandBase * verticalDensity;
+                if (baseDensity < 0.05f)
+                {
+                    stats.earlyRejects++;
+                    continue;
+                }
+
+                float volumetricNoise = m_noise3D.GetNoise(dx, dy, dz);
+                volumetricNoise = (volumetricNoise + 1.0f) * 0.5f;
+
+                float terrainNoise = m_noise2D.GetNoise(dx, dz);
+                terrainNoise = (terrainNoise + 1.0f) * 0.5f;
+
+                float finalDensity = islandBase * verticalDensity * (volumetricNoise * 0.6f + terrainNoise * 0.4f);
+                if (finalDensity > m_settings.densityThreshold)
+                {
+                    blockIDs[lx + ly * SIZE + lz * SIZE * SIZE] = blockID;
+                    stats.voxelsGenerated++;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,325 @@
+// IslandSystemBenchmark.cpp - Standalone IslandChunkSystem benchmarks
+#include "IslandSystemBenchmark.h"
+#include "IslandChunkSystem.h"
+#include "IslandDensity.h"
+#include "../Physics/PhysicsSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace IslandSystemBenchmark {
+
+namespace {
+
+constexpr int ISLAND_COUNT = 8;
+constexpr int ISLAND_EXTENT = 48;          // Voxels per axis filled per island (3x3x3 chunks)
+constexpr int WRITE_EVERY = 64;            // One write per this many ops
+constexpr auto RUN_TIME = std::chrono::milliseconds(500);
+
+// Cheap per-thread PRNG (xorshift32) so the generator itself never contends
+struct XorShift
+{
+    uint32_t state;
+    uint32_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+};
+
+uint64_t runThreads(IslandChunkSystem& system, const std::vector<uint32_t>& islandIDs, unsigned threadCount)
+{
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> opCounts(threadCount, 0);
+    std::vector<std::thread> threads;
+
+    for (unsigned t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            XorShift rng{0x9E3779B9u * (t + 1)};
+            // Writes go to the thread's own island; reads are spread over all of them
+            const uint32_t ownIsland = islandIDs[t % islandIDs.size()];
+            uint64_t ops = 0;
+            volatile uint32_t sink = 0;
+
+            while (!start.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                const uint32_t r = rng.next();
+                const uint32_t islandID = islandIDs[r % islandIDs.size()];
+                const Vec3 pos(static_cast<float>((r >> 8) % ISLAND_EXTENT), static_cast<float>((r >> 14) % ISLAND_EXTENT),
+                               static_cast<float>((r >> 20) % ISLAND_EXTENT));
+
+                if (ops % WRITE_EVERY == WRITE_EVERY - 1)
+                {
+                    // Above the filled cube, one chunk column slot per thread (no two threads write one chunk);
+                    // the first write creates the chunk under the exclusive island lock
+                    const Vec3 writePos(static_cast<float>((r >> 8) % VoxelChunk::SIZE),
+                                        static_cast<float>(ISLAND_EXTENT + t * VoxelChunk::SIZE + (r >> 14) % VoxelChunk::SIZE),
+                                        static_cast<float>((r >> 20) % VoxelChunk::SIZE));
+                    system.setVoxelWithAutoChunk(ownIsland, writePos, static_cast<uint8_t>(r & 1));
+                }
+                else
+                {
+                    switch (r & 3)
+                    {
+                        case 0:  sink = sink + (system.getChunkFromIsland(islandID, ChunkCoord(0, 0, 0)) != nullptr); break;
+                        case 1:  sink = sink + static_cast<uint32_t>(system.getIslandCenter(islandID).x); break;
+                        default: sink = sink + system.getVoxelFromIsland(islandID, pos); break;
+                    }
+                }
+                ++ops;
+            }
+            opCounts[t] = ops;
+        });
+    }
+
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(RUN_TIME);
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& thread : threads)
+        thread.join();
+
+    uint64_t total = 0;
+    for (uint64_t ops : opCounts)
+        total += ops;
+    return total;
+}
+
+constexpr int CAPSULE_COUNT = 4096;
+constexpr int CAPSULE_ROUNDS = 8;          // Every capsule queried this many times per mode
+constexpr int TERRAIN_EXTENT = 96;         // Voxels per horizontal axis (6x6 chunk columns)
+constexpr float CAPSULE_RADIUS = 0.55f;    // PlayerController's capsule
+constexpr float CAPSULE_HEIGHT = 3.0f;
+
+// Rolling ground around y = 20 with a 2-voxel pillar every 12 voxels (walls to brush against)
+int terrainHeight(int x, int z)
+{
+    if (x % 12 < 2 && z % 12 < 2)
+        return 34;
+    return 20 + static_cast<int>(6.0f * std::sin(x * 0.15f) * std::cos(z * 0.11f));
+}
+
+}  // namespace
+
+void runLockContention(unsigned maxThreads)
+{
+    if (maxThreads == 0)
+        maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << "\n====== ISLAND LOCK CONTENTION BENCHMARK ======" << std::endl;
+    std::cout << "   " << ISLAND_COUNT << " islands, " << ISLAND_EXTENT << "^3 voxels each, 1/" << WRITE_EVERY
+              << " ops write, " << RUN_TIME.count() << "ms per run" << std::endl;
+
+    // Private system - Lean chunks (no meshing), nothing shared with the running game
+    IslandChunkSystem system;
+    system.setChunkProfile(ChunkProfile::Lean);
+
+    std::vector<uint32_t> islandIDs;
+    for (int i = 0; i < ISLAND_COUNT; ++i)
+    {
+        uint32_t islandID = system.createIsland(Vec3(i * 100.0f, 0.0f, 0.0f));
+        islandIDs.push_back(islandID);
+        for (int z = 0; z < ISLAND_EXTENT; ++z)
+            for (int y = 0; y < ISLAND_EXTENT; ++y)
+                for (int x = 0; x < ISLAND_EXTENT; ++x)
+                    system.setVoxelWithAutoChunk(islandID, Vec3(x, y, z), ((x + y + z) & 3) ? 1 : 0);
+    }
+
+    // 1, 2, 4 ... plus maxThreads itself when it isn't a power of two
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2)
+        threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+
+    double baseline = 0.0;
+    for (unsigned threads : threadCounts)
+    {
+        const uint64_t ops = runThreads(system, islandIDs, threads);
+        const double opsPerSecond = ops * 1000.0 / RUN_TIME.count();
+        if (threads == 1)
+            baseline = opsPerSecond;
+
+        std::cout << "   " << std::setw(3) << threads << " thread(s): " << std::fixed << std::setprecision(2)
+                  << opsPerSecond / 1e6 << " Mops/s  (x" << opsPerSecond / std::max(1.0, baseline) << " vs 1 thread)"
+                  << std::endl;
+    }
+
+    std::cout << "==============================================\n" << std::endl;
+}
+
+bool runWorldGenDensity()
+{
+    constexpr uint32_t SEEDS[] = {1337u, 42u, 9001u};
+    constexpr float RADII[] = {64.0f, 160.0f};
+
+    std::cout << "\n====== WORLD GEN DENSITY BENCHMARK ======" << std::endl;
+
+    bool allIdentical = true;
+    for (float radius : RADII)
+    {
+        for (uint32_t seed : SEEDS)
+        {
+            IslandDensityField::Settings settings;
+            settings.seed = seed;
+            settings.radius = radius;
+            const IslandDensityField density(settings);
+
+            const int searchRadius = density.getSearchRadius();
+            const int islandHeight = density.getIslandHeight();
+            const ChunkCoord minChunk = FloatingIsland::voxelToChunkCoord(ChunkCoord(-searchRadius, -islandHeight, -searchRadius));
+            const ChunkCoord maxChunk = FloatingIsland::voxelToChunkCoord(ChunkCoord(searchRadius, islandHeight, searchRadius));
+
+            std::chrono::duration<double, std::milli> referenceTime{0};
+            std::chrono::duration<double, std::milli> batchedTime{0};
+            int chunks = 0;
+            int skipped = 0;
+            int mismatched = 0;
+            long long voxels = 0;
+
+            for (int cz = minChunk.z; cz <= maxChunk.z; ++cz)
+            for (int cy = minChunk.y; cy <= maxChunk.y; ++cy)
+            for (int cx = minChunk.x; cx <= maxChunk.x; ++cx)
+            {
+                const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(ChunkCoord(cx, cy, cz));
+                uint8_t reference[VoxelChunk::VOLUME] = {};
+                uint8_t batched[VoxelChunk::VOLUME] = {};
+                IslandDensityField::FillStats referenceStats;
+                IslandDensityField::FillStats batchedStats;
+
+                auto start = std::chrono::steady_clock::now();
+                density.fillChunkReference(origin, BlockID::DIRT, reference, referenceStats);
+                auto mid = std::chrono::steady_clock::now();
+                const bool empty = density.isChunkProvablyEmpty(origin);
+                if (!empty)
+                    density.fillChunk(origin, BlockID::DIRT, batched, batchedStats);
+                auto end = std::chrono::steady_clock::now();
+
+                referenceTime += mid - start;
+                batchedTime += end - mid;
+                ++chunks;
+                skipped += empty ? 1 : 0;
+                voxels += referenceStats.voxelsGenerated;
+                if (std::memcmp(reference, batched, sizeof(reference)) != 0)
+                    ++mismatched;
+            }
+
+            allIdentical = allIdentical && mismatched == 0;
+            std::cout << "   seed " << std::setw(5) << seed << " radius " << std::setw(4) << radius << ": " << chunks
+                      << " chunks (" << skipped << " proven empty), " << voxels << " voxels | reference " << std::fixed
+                      << std::setprecision(1) << referenceTime.count() << "ms, batched " << batchedTime.count()
+                      << "ms (x" << std::setprecision(2) << referenceTime.count() / std::max(0.001, batchedTime.count())
+                      << ") | " << (mismatched == 0 ? "identical" : "MISMATCH") << std::endl;
+            if (mismatched != 0)
+                std::cout << "   ❌ " << mismatched << " chunks differ from the reference" << std::endl;
+        }
+    }
+
+    std::cout << (allIdentical ? "   ✅ Batched output identical to reference on every seed"
+                               : "   ❌ Batched output differs from reference")
+              << std::endl;
+    std::cout << "=========================================\n" << std::endl;
+    return allIdentical;
+}
+
+void runCapsuleCollision()
+{
+    std::cout << "\n====== CAPSULE COLLISION BENCHMARK ======" << std::endl;
+
+    // Private system and physics - Lean chunks (collision only), nothing shared with the running game
+    IslandChunkSystem system;
+    system.setChunkProfile(ChunkProfile::Lean);
+    const uint32_t islandID = system.createIsland(Vec3(0.0f, 0.0f, 0.0f));
+    for (int z = 0; z < TERRAIN_EXTENT; ++z)
+        for (int x = 0; x < TERRAIN_EXTENT; ++x)
+            for (int y = 0, height = terrainHeight(x, z); y < height; ++y)
+                system.setVoxelWithAutoChunk(islandID, Vec3(x, y, z), BlockID::DIRT);
+
+    std::vector<VoxelChunk*> chunks;
+    system.getAllChunks(chunks);
+    size_t faces = 0;
+    for (VoxelChunk* chunk : chunks)
+    {
+        chunk->generateMesh(false);
+        faces += chunk->getCollisionMesh()->faces.size();
+    }
+
+    PhysicsSystem physics;
+    physics.setIslandSystem(&system);
+
+    // Feet just above, on or slightly into the ground, some of them pressed against a pillar
+    XorShift rng{0x2545F491u};
+    std::vector<Vec3> capsules;
+    capsules.reserve(CAPSULE_COUNT);
+    for (int i = 0; i < CAPSULE_COUNT; ++i)
+    {
+        const uint32_t r = rng.next();
+        const float x = 2.0f + (r % 9100) * 0.01f;
+        const float z = 2.0f + ((r >> 13) % 9100) * 0.01f;
+        const float feetOffset = ((r >> 26) % 32) * 0.025f - 0.2f;  // -0.2 .. +0.575
+        const float feet = terrainHeight(static_cast<int>(x), static_cast<int>(z)) + feetOffset;
+        capsules.push_back(Vec3(x, feet + CAPSULE_HEIGHT * 0.5f, z));
+    }
+
+    std::cout << "   " << chunks.size() << " chunks, " << faces << " collision faces, " << CAPSULE_COUNT
+              << " capsules x " << CAPSULE_ROUNDS << " rounds" << std::endl;
+
+    const PhysicsSystem::CapsuleCollisionMode modes[] = {PhysicsSystem::CapsuleCollisionMode::CollisionMesh,
+                                                         PhysicsSystem::CapsuleCollisionMode::OccupancyGrid};
+    const char* modeNames[] = {"collision mesh", "occupancy grid"};
+    std::vector<uint8_t> hits[2];
+    double milliseconds[2] = {};
+    for (int mode = 0; mode < 2; ++mode)
+    {
+        physics.setCapsuleCollisionMode(modes[mode]);
+        hits[mode].assign(capsules.size(), 0);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < CAPSULE_ROUNDS; ++round)
+        {
+            for (size_t i = 0; i < capsules.size(); ++i)
+            {
+                Vec3 normal;
+                hits[mode][i] = physics.checkCapsuleCollision(capsules[i], CAPSULE_RADIUS, CAPSULE_HEIGHT, normal) ? 1 : 0;
+            }
+        }
+        milliseconds[mode] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        size_t hitCount = 0;
+        for (uint8_t hit : hits[mode])
+            hitCount += hit;
+        const double queries = static_cast<double>(capsules.size()) * CAPSULE_ROUNDS;
+        std::cout << "   " << std::setw(14) << modeNames[mode] << ": " << std::fixed << std::setprecision(1)
+                  << milliseconds[mode] << "ms, " << std::setprecision(0) << milliseconds[mode] * 1e6 / queries
+                  << " ns/query, " << hitCount << " hits" << std::endl;
+    }
+
+    // The face loop tests each face as a square grown by the radius, the grid the exact capsule -
+    // they part ways only within about a radius of a voxel edge
+    size_t meshOnly = 0;
+    size_t gridOnly = 0;
+    for (size_t i = 0; i < capsules.size(); ++i)
+    {
+        meshOnly += hits[0][i] && !hits[1][i] ? 1 : 0;
+        gridOnly += hits[1][i] && !hits[0][i] ? 1 : 0;
+    }
+
+    std::cout << "   grid x" << std::setprecision(2) << milliseconds[0] / std::max(0.001, milliseconds[1])
+              << " vs mesh | disagreements: " << meshOnly << " mesh only, " << gridOnly << " grid only" << std::endl;
+    std::cout << "=========================================\n" << std::endl;
+}
+
+}  // namespace IslandSystemBenchmark
@@ -0,0 +1,20 @@
+// IslandSystemBenchmark.h - Standalone IslandChunkSystem benchmarks (run from the command line, no window)
+#pragma once
+
+namespace IslandSystemBenchmark {
+
+    // Lock contention: threads hammer voxel/chunk/center reads (with a trickle of chunk-creating
+    // writes) on a private island system, at 1, 2, 4 ... hardware threads. Prints ops/s and
+    // scaling vs one thread. maxThreads = 0 uses all hardware threads.
+    void runLockContention(unsigned maxThreads = 0);
+
+    // World generation density: on fixed seeds, fills every chunk of an island with the reference
+    // evaluator (FastNoiseLite per voxel) and the batched one (column cache, SIMD noise, empty-chunk
+    // skip), compares the voxels byte for byte and prints both timings. False on any mismatch.
+    bool runWorldGenDensity();
+
+    // Capsule collision: a crowd of player-sized capsules resting on, sunk into or brushing the walls
+    // of a hilly island, each queried through both PhysicsSystem narrow phases (occupancy grid and
+    // per-face collision mesh). Prints time per query, hit counts and where the two disagree.
+    void runCapsuleCollision();
+}
@@ -0,0 +1,194 @@
+// MeshWorkerPool.cpp - Background chunk meshing implementation
+#include "MeshWorkerPool.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "../Profiling/Profiler.h"
+#include "../Rendering/MDIRenderer.h"
+
+std::unique_ptr<MeshWorkerPool> g_meshWorkerPool;
+
+MeshWorkerPool::~MeshWorkerPool()
+{
+    shutdown();
+}
+
+bool MeshWorkerPool::initialize(unsigned workerCount)
+{
+    if (!m_workers.empty())
+    {
+        std::cerr << "⚠️  MeshWorkerPool already initialized" << std::endl;
+        return false;
+    }
+
+    if (workerCount == 0)
+    {
+        // Leave one hardware thread for the render/main loop
+        workerCount = std::max(2u, std::thread::hardware_concurrency()) - 1;
+    }
+
+    m_stopping = false;
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&MeshWorkerPool::workerLoop, this);
+    }
+
+    std::cout << "🧵 Mesh worker pool: " << workerCount << " thread(s)" << std::endl;
+    return true;
+}
+
+void MeshWorkerPool::shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+    m_workers.clear();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.clear();
+    m_pending.clear();
+    m_completed.clear();
+}
+
+void MeshWorkerPool::requestRemesh(VoxelChunk* chunk, bool generateLighting)
+{
+    if (!chunk)
+        return;
+
+    // Snapshot on the caller's thread - it owns this chunk's voxels, so no voxel lock is needed.
+    // Bumping the chunk's request ID here is what marks any older job stale.
+    auto build = chunk->prepareMeshBuild(generateLighting);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_stats.requested;
+
+        auto it = m_pending.find(chunk);
+        if (it != m_pending.end())
+        {
+            // Still queued - replace the snapshot, keep its place in line
+            it->second = std::move(build);
+            ++m_stats.cancelled;
+            return;
+        }
+
+        m_pending.emplace(chunk, std::move(build));
+        m_queue.push_back(chunk);
+    }
+    m_workAvailable.notify_one();
+}
+
+void MeshWorkerPool::cancelChunk(VoxelChunk* chunk)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_pending.erase(chunk) > 0)
+        ++m_stats.cancelled;  // Its m_queue entry is skipped by the worker that pops it
+
+    m_buildFinished.wait(lock, [&] { return m_inFlight.find(chunk) == m_inFlight.end(); });
+
+    auto removed = std::remove_if(m_completed.begin(), m_completed.end(),
+                                  [chunk](const CompletedBuild& done) { return done.chunk == chunk; });
+    m_stats.cancelled += static_cast<uint64_t>(std::distance(removed, m_completed.end()));
+    m_completed.erase(removed, m_completed.end());
+}
+
+void MeshWorkerPool::workerLoop()
+{
+    while (true)
+    {
+        VoxelChunk* chunk = nullptr;
+        std::unique_ptr<VoxelChunk::MeshBuild> build;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_workAvailable.wait(lock, [this] { return m_stopping || !m_queue.empty(); });
+            if (m_stopping)
+                return;
+
+            chunk = m_queue.front();
+            m_queue.pop_front();
+
+            auto it = m_pending.find(chunk);
+            if (it == m_pending.end())
+                continue;  // Cancelled while queued
+
+            build = std::move(it->second);
+            m_pending.erase(it);
+            ++m_inFlight[chunk];
+        }
+
+        bool finished = false;
+        {
+            PROFILE_SCOPE("MeshWorkerPool::build");
+            finished = chunk->buildMesh(*build);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_inFlight[chunk] == 0)
+                m_inFlight.erase(chunk);
+
+            if (finished && !chunk->isMeshBuildStale(*build))
+            {
+                ++m_stats.built;
+                m_completed.push_back({chunk, std::move(build)});
+            }
+            else
+            {
+                ++m_stats.cancelled;
+            }
+        }
+        m_buildFinished.notify_all();
+    }
+}
+
+size_t MeshWorkerPool::publishCompleted()
+{
+    PROFILE_SCOPE("MeshWorkerPool::publishCompleted");
+
+    std::vector<CompletedBuild> ready;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ready.swap(m_completed);
+    }
+
+    size_t published = 0;
+    for (auto& done : ready)
+    {
+        // Re-dirtied after the worker finished - the newer job will publish instead
+        if (done.chunk->isMeshBuildStale(*done.build))
+            continue;
+
+        done.chunk->publishMeshBuild(*done.build);
+        ++published;
+
+        // Unregistered chunks are picked up by syncPhysicsToChunks() with their transform
+        if (g_mdiRenderer && done.chunk->getMDIIndex() >= 0)
+        {
+            g_mdiRenderer->queueChunkMeshUpdate(done.chunk->getMDIIndex(), done.chunk);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.published += published;
+    m_stats.cancelled += ready.size() - published;
+    return published;
+}
+
+MeshWorkerPool::Statistics MeshWorkerPool::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics stats = m_stats;
+    stats.pending = m_pending.size();
+    stats.workers = m_workers.size();
+    return stats;
+}
@@ -0,0 +1,74 @@
+// MeshWorkerPool.h - Background chunk meshing (job queue + worker threads)
+#pragma once
+
+#include "VoxelChunk.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Remesh pipeline for the client:
+//   requestRemesh (chunk owner thread) - snapshot voxels, queue a job; re-requesting a chunk
+//                                        supersedes its queued or in-flight job
+//   workers                            - build mesh, collision and light maps into a back buffer
+//   publishCompleted (render thread)   - swap finished buffers in, queue GPU uploads
+// The render thread never meshes; workers never touch live voxel, mesh or GL state.
+class MeshWorkerPool
+{
+   public:
+    MeshWorkerPool() = default;
+    ~MeshWorkerPool();
+
+    bool initialize(unsigned workerCount = 0);  // 0 = hardware threads - 1
+    void shutdown();
+
+    void requestRemesh(VoxelChunk* chunk, bool generateLighting = true);
+
+    // Forget a chunk entirely (queued job, finished result) and wait out an in-flight build
+    void cancelChunk(VoxelChunk* chunk);
+
+    // Render thread: publish finished builds, returns how many were swapped in
+    size_t publishCompleted();
+
+    struct Statistics
+    {
+        uint64_t requested = 0;
+        uint64_t built = 0;
+        uint64_t cancelled = 0;  // Superseded before publish (re-dirtied) or chunk removed
+        uint64_t published = 0;
+        size_t pending = 0;
+        size_t workers = 0;
+    };
+    Statistics getStatistics() const;
+
+   private:
+    struct CompletedBuild
+    {
+        VoxelChunk* chunk;
+        std::unique_ptr<VoxelChunk::MeshBuild> build;
+    };
+
+    void workerLoop();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_workAvailable;
+    std::condition_variable m_buildFinished;
+
+    std::deque<VoxelChunk*> m_queue;  // FIFO of chunks with a pending build
+    std::unordered_map<VoxelChunk*, std::unique_ptr<VoxelChunk::MeshBuild>> m_pending;  // Latest snapshot per chunk
+    std::unordered_map<VoxelChunk*, int> m_inFlight;
+    std::vector<CompletedBuild> m_completed;
+
+    std::vector<std::thread> m_workers;
+    bool m_stopping = false;
+    Statistics m_stats;
+};
+
+// Global worker pool (created by GameClient; null on the headless server - chunks mesh inline there)
+extern std::unique_ptr<MeshWorkerPool> g_meshWorkerPool;
@@ -0,0 +1,393 @@
+// RegionFile.cpp - Memory-mapped, append-only chunk store for one island
+#include "RegionFile.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+#include "VoxelChunk.h"
+#include "../Network/VoxelCompression.h"
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace
+{
+constexpr char REGION_MAGIC[4] = {'I', 'R', 'G', 'N'};
+constexpr uint32_t REGION_VERSION = 1;
+
+// Garbage below this is never worth a full rewrite
+constexpr uint64_t COMPACT_MIN_GARBAGE = 1ull << 20;
+
+enum PayloadEncoding : uint8_t
+{
+    ENCODING_UNIFORM = 0,  // One block ID for the whole chunk
+    ENCODING_LZ4 = 1,
+    ENCODING_RAW = 2       // LZ4 failed - VOLUME bytes as is
+};
+
+struct RegionHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t tableOffset;
+    uint32_t chunkCount;
+    uint32_t reserved;
+    uint64_t garbageBytes;
+};
+static_assert(sizeof(RegionHeader) == 32, "RegionHeader is an on-disk layout");
+
+struct TableEntry
+{
+    int32_t x, y, z;
+    uint32_t size;
+    uint64_t offset;
+};
+static_assert(sizeof(TableEntry) == 24, "TableEntry is an on-disk layout");
+
+RegionHeader makeHeader(uint64_t tableOffset, uint32_t chunkCount, uint64_t garbageBytes)
+{
+    RegionHeader header{};
+    std::memcpy(header.magic, REGION_MAGIC, sizeof(REGION_MAGIC));
+    header.version = REGION_VERSION;
+    header.tableOffset = tableOffset;
+    header.chunkCount = chunkCount;
+    header.garbageBytes = garbageBytes;
+    return header;
+}
+
+void writeTable(std::ostream& out, const ChunkCoordMap<RegionFile::StoredChunk>& table)
+{
+    std::vector<TableEntry> entries;
+    entries.reserve(table.size());
+    for (const auto& [chunkCoord, stored] : table)
+        entries.push_back({chunkCoord.x, chunkCoord.y, chunkCoord.z, stored.size, stored.offset});
+    out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(TableEntry));
+}
+}  // namespace
+
+// ================================
+// MappedFile
+// ================================
+
+bool MappedFile::open(const std::string& path)
+{
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_file = file;
+    m_mapping = mapping;
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    // The mapping keeps the file referenced - the descriptor isn't needed past this point
+    void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+        return false;
+
+    m_data = static_cast<const uint8_t*>(view);
+    m_size = static_cast<size_t>(fileStat.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (!m_data)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+    CloseHandle(m_file);
+    m_mapping = nullptr;
+    m_file = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
+
+// ================================
+// RegionFile
+// ================================
+
+bool RegionFile::open(const std::string& path)
+{
+    close();
+    if (!m_mapping.open(path))
+        return false;
+
+    const uint8_t* data = m_mapping.data();
+    const size_t fileSize = m_mapping.size();
+
+    RegionHeader header;
+    if (fileSize < sizeof(header))
+    {
+        std::cerr << "⚠️  Region file " << path << " is truncated" << std::endl;
+        close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, REGION_MAGIC, sizeof(REGION_MAGIC)) != 0 || header.version != REGION_VERSION)
+    {
+        std::cerr << "⚠️  Region file " << path << " has an unknown format" << std::endl;
+        close();
+        return false;
+    }
+    if (header.tableOffset < sizeof(header) || header.tableOffset > fileSize ||
+        (fileSize - header.tableOffset) / sizeof(TableEntry) < header.chunkCount)
+    {
+        std::cerr << "⚠️  Region file " << path << " has a corrupt chunk table" << std::endl;
+        close();
+        return false;
+    }
+
+    m_chunks.reserve(header.chunkCount);
+    size_t badEntries = 0;
+    for (uint32_t i = 0; i < header.chunkCount; ++i)
+    {
+        TableEntry entry;
+        std::memcpy(&entry, data + header.tableOffset + i * sizeof(TableEntry), sizeof(entry));
+
+        // Payloads always sit between the header and the table they belong to
+        if (entry.size < 2 || entry.offset < sizeof(header) || entry.offset + entry.size > header.tableOffset)
+        {
+            ++badEntries;
+            continue;
+        }
+        m_chunks[ChunkCoord(entry.x, entry.y, entry.z)] = {entry.offset, entry.size};
+    }
+    if (badEntries > 0)
+        std::cerr << "⚠️  Region file " << path << ": skipped " << badEntries << " bad chunk entries" << std::endl;
+
+    m_tableOffset = header.tableOffset;
+    m_garbageBytes = header.garbageBytes;
+    return true;
+}
+
+void RegionFile::close()
+{
+    m_mapping.close();
+    m_chunks.clear();
+    m_tableOffset = 0;
+    m_garbageBytes = 0;
+}
+
+bool RegionFile::readChunk(const ChunkCoord& chunkCoord, uint8_t* voxels) const
+{
+    auto it = m_chunks.find(chunkCoord);
+    if (it == m_chunks.end())
+        return false;
+
+    const uint8_t* payload = m_mapping.data() + it->second.offset;
+    const uint32_t size = it->second.size;
+    switch (payload[0])
+    {
+        case ENCODING_UNIFORM:
+            std::memset(voxels, payload[1], VoxelChunk::VOLUME);
+            return true;
+        case ENCODING_LZ4:
+            return VoxelCompression::decompressLZ4(payload + 1, size - 1, voxels, VoxelChunk::VOLUME);
+        case ENCODING_RAW:
+            if (size - 1 != static_cast<uint32_t>(VoxelChunk::VOLUME))
+                return false;
+            std::memcpy(voxels, payload + 1, VoxelChunk::VOLUME);
+            return true;
+        default:
+            std::cerr << "⚠️  Unknown chunk encoding " << static_cast<int>(payload[0]) << std::endl;
+            return false;
+    }
+}
+
+void RegionFile::encodeChunk(const uint8_t* voxels, std::vector<uint8_t>& out)
+{
+    out.clear();
+    if (std::all_of(voxels + 1, voxels + VoxelChunk::VOLUME, [&](uint8_t v) { return v == voxels[0]; }))
+    {
+        out.push_back(ENCODING_UNIFORM);
+        out.push_back(voxels[0]);
+        return;
+    }
+
+    std::vector<uint8_t> compressed;
+    if (VoxelCompression::compressLZ4(voxels, VoxelChunk::VOLUME, compressed) == 0)
+    {
+        out.push_back(ENCODING_RAW);
+        out.insert(out.end(), voxels, voxels + VoxelChunk::VOLUME);
+        return;
+    }
+    out.reserve(compressed.size() + 1);
+    out.push_back(ENCODING_LZ4);
+    out.insert(out.end(), compressed.begin(), compressed.end());
+}
+
+bool RegionFile::commit(const std::string& path, const std::vector<Payload>& written,
+                        const std::vector<ChunkCoord>& removed)
+{
+    // Entries that survive this commit untouched
+    ChunkCoordMap<StoredChunk> table = m_chunks;
+    uint64_t garbage = m_garbageBytes;
+    auto dropEntry = [&](const ChunkCoord& chunkCoord)
+    {
+        auto it = table.find(chunkCoord);
+        if (it == table.end())
+            return;
+        garbage += it->second.size;
+        table.erase(it);
+    };
+    for (const ChunkCoord& chunkCoord : removed)
+        dropEntry(chunkCoord);
+    for (const Payload& payload : written)
+        dropEntry(payload.chunkCoord);
+
+    uint64_t liveBytes = 0;
+    for (const auto& [chunkCoord, stored] : table)
+        liveBytes += stored.size;
+    for (const Payload& payload : written)
+        liveBytes += payload.bytes.size();
+
+    garbage += static_cast<uint64_t>(m_chunks.size()) * sizeof(TableEntry);  // The table being replaced
+    if (!isOpen() || (garbage > COMPACT_MIN_GARBAGE && garbage > liveBytes))
+        return rewrite(path, table, written);
+
+    // Append in place: payloads, then the new table, then repoint the header
+    const uint64_t appendAt = m_mapping.size();
+    m_mapping.close();
+
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "❌ Cannot open region file " << path << " for writing" << std::endl;
+        open(path);
+        return false;
+    }
+
+    file.seekp(static_cast<std::streamoff>(appendAt));
+    uint64_t cursor = appendAt;
+    for (const Payload& payload : written)
+    {
+        file.write(reinterpret_cast<const char*>(payload.bytes.data()), payload.bytes.size());
+        table[payload.chunkCoord] = {cursor, static_cast<uint32_t>(payload.bytes.size())};
+        cursor += payload.bytes.size();
+    }
+
+    const uint64_t tableOffset = cursor;
+    writeTable(file, table);
+    file.flush();
+
+    const RegionHeader header = makeHeader(tableOffset, static_cast<uint32_t>(table.size()), garbage);
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.flush();
+
+    const bool ok = static_cast<bool>(file);
+    file.close();
+    if (!ok)
+        std::cerr << "❌ Failed writing region file " << path << std::endl;
+
+    // Either way the file on disk is consistent - remap whichever table the header points at
+    return open(path) && ok;
+}
+
+bool RegionFile::rewrite(const std::string& path, const ChunkCoordMap<StoredChunk>& kept,
+                         const std::vector<Payload>& written)
+{
+    const std::string tempPath = path + ".tmp";
+    ChunkCoordMap<StoredChunk> table;
+    table.reserve(kept.size() + written.size());
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file)
+        {
+            std::cerr << "❌ Cannot create region file " << tempPath << std::endl;
+            return false;
+        }
+
+        RegionHeader header{};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        uint64_t cursor = sizeof(header);
+
+        // Kept payloads are copied straight out of the old mapping
+        for (const auto& [chunkCoord, stored] : kept)
+        {
+            file.write(reinterpret_cast<const char*>(m_mapping.data() + stored.offset), stored.size);
+            table[chunkCoord] = {cursor, stored.size};
+            cursor += stored.size;
+        }
+        for (const Payload& payload : written)
+        {
+            file.write(reinterpret_cast<const char*>(payload.bytes.data()), payload.bytes.size());
+            table[payload.chunkCoord] = {cursor, static_cast<uint32_t>(payload.bytes.size())};
+            cursor += payload.bytes.size();
+        }
+
+        writeTable(file, table);
+        header = makeHeader(cursor, static_cast<uint32_t>(table.size()), 0);
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.flush();
+        if (!file)
+        {
+            std::cerr << "❌ Failed writing region file " << tempPath << std::endl;
+            return false;
+        }
+    }
+
+    // Unmap before the swap - Windows refuses to replace a mapped file
+    m_mapping.close();
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::cerr << "❌ Cannot replace region file " << path << ": " << error.message() << std::endl;
+        std::filesystem::remove(tempPath, error);
+        open(path);
+        return false;
+    }
+    return open(path);
+}
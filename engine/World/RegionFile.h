@@ -0,0 +1,94 @@
+// RegionFile.h - Memory-mapped, append-only chunk store for one island
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ChunkCoord.h"
+
+// Read-only mapping of a whole file (mmap / MapViewOfFile)
+class MappedFile
+{
+   public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return m_data != nullptr; }
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+   private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#endif
+};
+
+// File layout: [header][chunk payloads ...][chunk table]
+//   payload - 1 encoding byte, then the uniform block ID or the LZ4 stream of VOLUME voxels
+//   table   - (chunk coord, offset, size) per stored chunk; the header points at the current one
+// A commit appends the new payloads and a new table, then rewrites the header last: until that
+// write lands the previous table is still the valid one. Superseded payloads stay behind as garbage
+// until it outgrows the live data, then the file is rewritten compacted.
+//
+// Opening only reads the table - payloads are paged in by the OS as readChunk touches them.
+// readChunk is safe from any number of threads; commit must not overlap with it.
+class RegionFile
+{
+   public:
+    struct StoredChunk
+    {
+        uint64_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    struct Payload
+    {
+        ChunkCoord chunkCoord;
+        std::vector<uint8_t> bytes;  // From encodeChunk
+    };
+
+    RegionFile() = default;
+    RegionFile(const RegionFile&) = delete;
+    RegionFile& operator=(const RegionFile&) = delete;
+
+    // Maps the file and reads its chunk table; false if missing or corrupt
+    bool open(const std::string& path);
+    void close();
+    bool isOpen() const { return m_mapping.isOpen(); }
+
+    const ChunkCoordMap<StoredChunk>& getChunks() const { return m_chunks; }
+    bool contains(const ChunkCoord& chunkCoord) const { return m_chunks.contains(chunkCoord); }
+
+    // Decode a stored chunk into VOLUME bytes (x fastest, then y, then z)
+    bool readChunk(const ChunkCoord& chunkCoord, uint8_t* voxels) const;
+
+    // Uniform chunks encode to 2 bytes, everything else to LZ4
+    static void encodeChunk(const uint8_t* voxels, std::vector<uint8_t>& out);
+
+    // Store `written` (replacing entries with the same coord) and drop `removed`, then remap.
+    // Creates the file if it doesn't exist yet.
+    bool commit(const std::string& path, const std::vector<Payload>& written, const std::vector<ChunkCoord>& removed);
+
+    uint64_t getFileSize() const { return m_mapping.size(); }
+    uint64_t getGarbageBytes() const { return m_garbageBytes; }
+
+   private:
+    // Whole new file next to the old one, swapped in by rename (drops all garbage)
+    bool rewrite(const std::string& path, const ChunkCoordMap<StoredChunk>& kept, const std::vector<Payload>& written);
+
+    MappedFile m_mapping;
+    ChunkCoordMap<StoredChunk> m_chunks;
+    uint64_t m_tableOffset = 0;
+    uint64_t m_garbageBytes = 0;
+};
@@ -0,0 +1,197 @@
+// VoxelAccessor.cpp - Scoped, chunk-caching voxel access to one island
+#include "VoxelAccessor.h"
+
+#include <algorithm>
+
+const ChunkCoord VoxelAccessor::NEIGHBOR_OFFSETS[6] = {
+    ChunkCoord(1, 0, 0), ChunkCoord(-1, 0, 0), ChunkCoord(0, 1, 0),
+    ChunkCoord(0, -1, 0), ChunkCoord(0, 0, 1), ChunkCoord(0, 0, -1)};
+
+VoxelAccessor::VoxelAccessor(IslandChunkSystem& system, uint32_t islandID, Mode mode)
+    : m_system(&system), m_islandID(islandID), m_mode(mode), m_tableLock(system.m_islandsMutex)
+{
+    // Lock order table -> island, same as every IslandChunkSystem method
+    FloatingIsland* island = system.findIsland(islandID);
+    if (!island)
+    {
+        m_tableLock.unlock();
+        return;
+    }
+
+    if (mode == Mode::Read)
+        m_islandReadLock = std::shared_lock<std::shared_mutex>(island->mutex);
+    else
+        m_islandWriteLock = std::unique_lock<std::shared_mutex>(island->mutex);
+    m_island = island;
+}
+
+VoxelAccessor::VoxelAccessor(const FloatingIsland& island) : m_island(&island), m_islandID(island.islandID)
+{
+}
+
+void VoxelAccessor::release()
+{
+    // Dirty marks go out while the island lock still keeps the chunks alive
+    if (m_system)
+    {
+        for (VoxelChunk* chunk : m_dirtyChunks)
+            m_system->markChunkDirty(chunk);
+    }
+    m_dirtyChunks.clear();
+
+    if (m_islandWriteLock.owns_lock())
+        m_islandWriteLock.unlock();
+    if (m_islandReadLock.owns_lock())
+        m_islandReadLock.unlock();
+    if (m_tableLock.owns_lock())
+        m_tableLock.unlock();
+
+    m_island = nullptr;
+    m_cachedChunk = nullptr;
+    m_cacheValid = false;
+}
+
+VoxelChunk* VoxelAccessor::getOrCreateChunk(const ChunkCoord& chunkCoord)
+{
+    if (VoxelChunk* chunk = chunkAt(chunkCoord))
+        return chunk;
+
+    // Exclusive island lock already held - create in place (chunk addresses stay stable across rehashes)
+    FloatingIsland& island = const_cast<FloatingIsland&>(*m_island);
+    m_cachedChunk = m_system->createChunkLocked(island, m_islandID, chunkCoord);
+    return m_cachedChunk;
+}
+
+VoxelChunk* VoxelAccessor::rehydrateChunk(const ChunkCoord& chunkCoord)
+{
+    if (m_island->coldChunks.empty())
+        return nullptr;
+    FloatingIsland& island = const_cast<FloatingIsland&>(*m_island);
+    return m_system->rehydrateChunkLocked(island, m_islandID, chunkCoord);
+}
+
+void VoxelAccessor::touch(VoxelChunk* chunk, const ChunkCoord& localMin, const ChunkCoord& localMax)
+{
+    m_dirtyChunks.insert(chunk);
+
+    // Boundary voxels also change the culled faces of the touching neighbor (0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X)
+    const int lo[3] = {localMin.x, localMin.y, localMin.z};
+    const int hi[3] = {localMax.x, localMax.y, localMax.z};
+    static const int faceAxis[6] = {1, 1, 2, 2, 0, 0};
+    for (int face = 0; face < 6; ++face)
+    {
+        const int axis = faceAxis[face];
+        const bool onEdge = (face & 1) ? hi[axis] == VoxelChunk::SIZE - 1 : lo[axis] == 0;
+        if (onEdge)
+        {
+            if (VoxelChunk* neighbor = chunk->getNeighbor(face))
+                m_dirtyChunks.insert(neighbor);
+        }
+    }
+}
+
+void VoxelAccessor::set(const ChunkCoord& voxel, uint8_t voxelType)
+{
+    if (!canWrite())
+        return;
+
+    const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+    if (voxelType == 0 && !chunkAt(chunkCoord))
+        return;  // Air into a missing chunk - nothing to create
+    VoxelChunk* chunk = getOrCreateChunk(chunkCoord);
+    const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+    chunk->setVoxel(local.x, local.y, local.z, voxelType);
+
+    if (m_mode == Mode::Edit)
+        touch(chunk, local, local);
+}
+
+void VoxelAccessor::getRegion(const ChunkCoord& min, const ChunkCoord& size, uint8_t* out)
+{
+    if (size.x <= 0 || size.y <= 0 || size.z <= 0)
+        return;
+
+    const ChunkCoord max(min.x + size.x - 1, min.y + size.y - 1, min.z + size.z - 1);
+    const ChunkCoord firstChunk = FloatingIsland::voxelToChunkCoord(min);
+    const ChunkCoord lastChunk = FloatingIsland::voxelToChunkCoord(max);
+
+    for (int cz = firstChunk.z; cz <= lastChunk.z; ++cz)
+    for (int cy = firstChunk.y; cy <= lastChunk.y; ++cy)
+    for (int cx = firstChunk.x; cx <= lastChunk.x; ++cx)
+    {
+        const ChunkCoord chunkCoord(cx, cy, cz);
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(chunkCoord);
+        const VoxelChunk* chunk = chunkAt(chunkCoord);
+
+        // Overlap of the box with this chunk, in island voxels
+        const int x0 = std::max(min.x, origin.x), x1 = std::min(max.x, origin.x + VoxelChunk::SIZE - 1);
+        const int y0 = std::max(min.y, origin.y), y1 = std::min(max.y, origin.y + VoxelChunk::SIZE - 1);
+        const int z0 = std::max(min.z, origin.z), z1 = std::min(max.z, origin.z + VoxelChunk::SIZE - 1);
+
+        for (int z = z0; z <= z1; ++z)
+        for (int y = y0; y <= y1; ++y)
+        {
+            uint8_t* row = out + (static_cast<size_t>(z - min.z) * size.y + (y - min.y)) * size.x;
+            if (!chunk)
+            {
+                std::fill(row + (x0 - min.x), row + (x1 - min.x) + 1, uint8_t(0));
+                continue;
+            }
+            for (int x = x0; x <= x1; ++x)
+                row[x - min.x] = chunk->getVoxel(x - origin.x, y - origin.y, z - origin.z);
+        }
+    }
+}
+
+void VoxelAccessor::setRegion(const ChunkCoord& min, const ChunkCoord& size, const uint8_t* in)
+{
+    if (!canWrite() || size.x <= 0 || size.y <= 0 || size.z <= 0)
+        return;
+
+    const ChunkCoord max(min.x + size.x - 1, min.y + size.y - 1, min.z + size.z - 1);
+    const ChunkCoord firstChunk = FloatingIsland::voxelToChunkCoord(min);
+    const ChunkCoord lastChunk = FloatingIsland::voxelToChunkCoord(max);
+
+    for (int cz = firstChunk.z; cz <= lastChunk.z; ++cz)
+    for (int cy = firstChunk.y; cy <= lastChunk.y; ++cy)
+    for (int cx = firstChunk.x; cx <= lastChunk.x; ++cx)
+    {
+        const ChunkCoord chunkCoord(cx, cy, cz);
+        const ChunkCoord origin = FloatingIsland::chunkCoordToVoxel(chunkCoord);
+
+        const int x0 = std::max(min.x, origin.x), x1 = std::min(max.x, origin.x + VoxelChunk::SIZE - 1);
+        const int y0 = std::max(min.y, origin.y), y1 = std::min(max.y, origin.y + VoxelChunk::SIZE - 1);
+        const int z0 = std::max(min.z, origin.z), z1 = std::min(max.z, origin.z + VoxelChunk::SIZE - 1);
+
+        auto rowAt = [&](int y, int z) {
+            return in + (static_cast<size_t>(z - min.z) * size.y + (y - min.y)) * size.x;
+        };
+
+        VoxelChunk* chunk = chunkAt(chunkCoord);
+        if (!chunk)
+        {
+            // Writing air into a missing chunk changes nothing - only create it for solid data
+            bool anySolid = false;
+            for (int z = z0; z <= z1 && !anySolid; ++z)
+                for (int y = y0; y <= y1 && !anySolid; ++y)
+                {
+                    const uint8_t* row = rowAt(y, z);
+                    anySolid = std::any_of(row + (x0 - min.x), row + (x1 - min.x) + 1, [](uint8_t v) { return v != 0; });
+                }
+            if (!anySolid)
+                continue;
+            chunk = getOrCreateChunk(chunkCoord);
+        }
+
+        for (int z = z0; z <= z1; ++z)
+        for (int y = y0; y <= y1; ++y)
+        {
+            const uint8_t* row = rowAt(y, z);
+            for (int x = x0; x <= x1; ++x)
+                chunk->setVoxel(x - origin.x, y - origin.y, z - origin.z, row[x - min.x]);
+        }
+
+        if (m_mode == Mode::Edit)
+            touch(chunk, ChunkCoord(x0, y0, z0) - origin, ChunkCoord(x1, y1, z1) - origin);
+    }
+}
@@ -0,0 +1,129 @@
+// VoxelAccessor.h - Scoped, chunk-caching voxel access to one island
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_set>
+
+#include "ChunkCoord.h"
+#include "IslandChunkSystem.h"
+
+// Pins one island for a batch of voxel reads/writes. The locks getVoxelFromIsland/setVoxelInIsland
+// take per voxel are taken once for the accessor's lifetime (table shared, then the island shared
+// for Read or exclusive for Write/Edit), and the last chunk touched is cached, so runs of nearby
+// voxels (flood fills, DDA steps, neighbor walks) skip the hash lookup entirely.
+//
+// A locking accessor holds the island table lock: while it is alive its thread must not call
+// IslandChunkSystem methods that lock (getVoxelFromIsland, getIslandCenter, createIsland, ...)
+// or open a second locking accessor - go through the accessor, or release() it first.
+class VoxelAccessor
+{
+public:
+    enum class Mode
+    {
+        Read,   // Shared island lock - runs alongside other readers
+        Write,  // Exclusive island lock, creates missing chunks, no remesh (generation, like setVoxelWithAutoChunk)
+        Edit    // Write + marks touched chunks (and boundary neighbors) dirty on release (like setVoxelInIsland)
+    };
+
+    VoxelAccessor(IslandChunkSystem& system, uint32_t islandID, Mode mode = Mode::Read);
+    // Unlocked read-only view - for callers that already own the island (generation, analysis
+    // of an island they hold, or loops that already walk getIslands())
+    explicit VoxelAccessor(const FloatingIsland& island);
+    ~VoxelAccessor() { release(); }
+
+    VoxelAccessor(const VoxelAccessor&) = delete;
+    VoxelAccessor& operator=(const VoxelAccessor&) = delete;
+
+    // Flushes pending dirty marks and drops the locks; the accessor is invalid afterwards
+    void release();
+
+    bool valid() const { return m_island != nullptr; }
+    const FloatingIsland* getIsland() const { return m_island; }
+
+    // Island-relative integer voxel position; 0 = air or no chunk
+    uint8_t get(const ChunkCoord& voxel)
+    {
+        const ChunkCoord chunkCoord = FloatingIsland::voxelToChunkCoord(voxel);
+        const VoxelChunk* chunk = chunkAt(chunkCoord);
+        if (!chunk)
+            return 0;
+        const ChunkCoord local = voxel - FloatingIsland::chunkCoordToVoxel(chunkCoord);
+        return chunk->getVoxel(local.x, local.y, local.z);
+    }
+    uint8_t get(int x, int y, int z) { return get(ChunkCoord(x, y, z)); }
+    bool isSolid(const ChunkCoord& voxel) { return get(voxel) != 0; }
+
+    // Write/Edit only (ignored in Read). Creates the chunk when missing.
+    void set(const ChunkCoord& voxel, uint8_t voxelType);
+
+    // Bulk copy of the box [min, min + size) to/from a flat buffer, x fastest:
+    // index = x + size.x * (y + size.y * z). Each chunk is resolved once per box, not per voxel.
+    // setRegion never creates a chunk for an all-air span.
+    void getRegion(const ChunkCoord& min, const ChunkCoord& size, uint8_t* out);
+    void setRegion(const ChunkCoord& min, const ChunkCoord& size, const uint8_t* in);
+
+    // Face neighbor offsets (+X, -X, +Y, -Y, +Z, -Z)
+    static const ChunkCoord NEIGHBOR_OFFSETS[6];
+
+    // fn(neighborPos, voxelType) for all 6 face neighbors
+    template <typename Fn>
+    void forEachNeighbor(const ChunkCoord& voxel, Fn&& fn)
+    {
+        for (const ChunkCoord& offset : NEIGHBOR_OFFSETS)
+        {
+            const ChunkCoord neighbor = voxel + offset;
+            fn(neighbor, get(neighbor));
+        }
+    }
+
+    // fn(neighborPos) for the solid face neighbors only
+    template <typename Fn>
+    void forEachSolidNeighbor(const ChunkCoord& voxel, Fn&& fn)
+    {
+        for (const ChunkCoord& offset : NEIGHBOR_OFFSETS)
+        {
+            const ChunkCoord neighbor = voxel + offset;
+            if (get(neighbor) != 0)
+                fn(neighbor);
+        }
+    }
+
+    // Chunk at a chunk coordinate (last lookup cached, misses included), or null.
+    // Write/Edit bring cold chunks back in place; Read (and the unlocked view) sees hot chunks only.
+    VoxelChunk* chunkAt(const ChunkCoord& chunkCoord)
+    {
+        if (!m_cacheValid || chunkCoord != m_cachedCoord)
+        {
+            m_cachedCoord = chunkCoord;
+            m_cachedChunk = m_island ? m_island->findChunk(chunkCoord) : nullptr;
+            if (!m_cachedChunk && canWrite())
+                m_cachedChunk = rehydrateChunk(chunkCoord);
+            m_cacheValid = true;
+        }
+        return m_cachedChunk;
+    }
+
+private:
+    bool canWrite() const { return m_system && m_mode != Mode::Read && m_island; }
+    VoxelChunk* getOrCreateChunk(const ChunkCoord& chunkCoord);
+    VoxelChunk* rehydrateChunk(const ChunkCoord& chunkCoord);  // Null unless cold
+    // Edit mode: remember the chunk plus the neighbors behind each face the local box touches
+    void touch(VoxelChunk* chunk, const ChunkCoord& localMin, const ChunkCoord& localMax);
+
+    IslandChunkSystem* m_system = nullptr;  // Null for the unlocked view
+    const FloatingIsland* m_island = nullptr;
+    uint32_t m_islandID = 0;
+    Mode m_mode = Mode::Read;
+
+    std::shared_lock<std::shared_mutex> m_tableLock;
+    std::shared_lock<std::shared_mutex> m_islandReadLock;
+    std::unique_lock<std::shared_mutex> m_islandWriteLock;
+
+    ChunkCoord m_cachedCoord;
+    VoxelChunk* m_cachedChunk = nullptr;
+    bool m_cacheValid = false;
+
+    std::unordered_set<VoxelChunk*> m_dirtyChunks;  // Edit mode, marked once each on release
+};
@@ -9,21 +9,39 @@
 #include <cmath>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <thread>
 #include <vector>
 #include <glad/gl.h>  // For OpenGL light map texture functions
+#ifdef _MSC_VER
+#include <intrin.h>  // _BitScanForward
+#endif
 
 #include "../Profiling/Profiler.h"
 #include "IslandChunkSystem.h"  // For inter-island raycast queries
+#include "MeshWorkerPool.h"
+#include "VoxelAccessor.h"
 
-// Static island system pointer for inter-chunk queries
-IslandChunkSystem* VoxelChunk::s_islandSystem = nullptr;
+// Meshing strategy - ENGINE_GREEDY_MESHING (CMake option) picks the build default
+#ifdef ENGINE_GREEDY_MESHING
+VoxelChunk::MeshingMode VoxelChunk::s_meshingMode = VoxelChunk::MeshingMode::Greedy;
+#else
+VoxelChunk::MeshingMode VoxelChunk::s_meshingMode = VoxelChunk::MeshingMode::Simple;
+#endif
+bool VoxelChunk::s_verifyMeshing = false;
 
-VoxelChunk::VoxelChunk()
+// Each chunk's voxel versions start at its own multiple of 2^32
+static std::atomic<uint64_t> s_nextVoxelVersionBase{1};
+
+VoxelChunk::VoxelChunk(ChunkProfile profile)
+    : m_profile(profile)
 {
-    // Initialize voxel data to empty (0 = air)
-    std::fill(voxels.begin(), voxels.end(), 0);
+    // Voxel storage starts as uniform air (no allocation)
     meshDirty = true;
+    m_voxelVersion = s_nextVoxelVersionBase.fetch_add(1, std::memory_order_relaxed) << 32;
+    
+    for (auto& neighbor : m_neighbors)
+        neighbor.store(nullptr, std::memory_order_relaxed);
     
     // Initialize collision mesh with empty shared_ptr
     collisionMesh = std::make_shared<CollisionMesh>();
@@ -37,6 +55,11 @@ VoxelChunk::VoxelChunk()
     // Initialize light maps
     for (int face = 0; face < 6; ++face) {
         lightMaps.getFaceMap(face).textureHandle = 0;
+        if (m_profile == ChunkProfile::Lean) {
+            // Lean chunks never light or render - release the per-face buffers
+            std::vector<uint8_t>().swap(lightMaps.getFaceMap(face).data);
+            continue;
+        }
         // Fill with default lighting (mid-gray = normal lighting)
         std::fill(lightMaps.getFaceMap(face).data.begin(), lightMaps.getFaceMap(face).data.end(), 128);
     }
@@ -44,6 +67,10 @@ VoxelChunk::VoxelChunk()
 
 VoxelChunk::~VoxelChunk()
 {
+    // Drop queued/finished background builds and wait out one in flight - they hold this pointer
+    if (g_meshWorkerPool)
+        g_meshWorkerPool->cancelChunk(this);
+    
     // Clean up VBO resources if they exist
     // We'll handle this through the VBORenderer to avoid OpenGL context issues
 }
@@ -52,15 +79,18 @@ uint8_t VoxelChunk::getVoxel(int x, int y, int z) const
 {
     if (x < 0 || x >= SIZE || y < 0 || y >= SIZE || z < 0 || z >= SIZE)
         return 0;  // Out of bounds = air
-    return voxels[x + y * SIZE + z * SIZE * SIZE];
+    return voxels.get(x + y * SIZE + z * SIZE * SIZE);
 }
 
 void VoxelChunk::setVoxel(int x, int y, int z, uint8_t type)
 {
     if (x < 0 || x >= SIZE || y < 0 || y >= SIZE || z < 0 || z >= SIZE)
         return;
-    voxels[x + y * SIZE + z * SIZE * SIZE] = type;
+    voxels.set(x + y * SIZE + z * SIZE * SIZE, type);
     meshDirty = true;
+    m_unsavedChanges = true;
+    m_writtenSinceIdleCheck = true;
+    m_voxelVersion++;
     lightingDirty = true;  // NEW: Mark lighting as needing update when voxels change
 }
 
@@ -72,11 +102,37 @@ void VoxelChunk::setRawVoxelData(const uint8_t* data, uint32_t size)
                   << " but got " << size << std::endl;
         return;
     }
-    std::copy(data, data + size, voxels.begin());
+    voxels.assign(data);
     meshDirty = true;
+    m_unsavedChanges = true;
+    m_writtenSinceIdleCheck = true;
+    m_voxelVersion++;
 }
 
-void VoxelChunk::setIslandContext(uint32_t islandID, const Vec3& chunkCoord)
+size_t VoxelChunk::getMemoryUsage() const
+{
+    size_t bytes = sizeof(VoxelChunk) + voxels.getMemoryUsage();
+    {
+        std::lock_guard<std::mutex> lock(meshMutex);
+        bytes += mesh.vertices.capacity() * sizeof(Vertex) + mesh.indices.capacity() * sizeof(uint32_t);
+    }
+    for (const FaceLightMap& faceMap : lightMaps.faceMaps)
+        bytes += faceMap.data.capacity();
+    if (auto collision = getCollisionMesh())
+        bytes += sizeof(CollisionMesh) + collision->faces.capacity() * sizeof(CollisionFace);
+    return bytes;
+}
+
+float VoxelChunk::advanceIdleTime(float seconds)
+{
+    if (m_writtenSinceIdleCheck)
+        resetIdleTime();
+    else
+        m_idleSeconds += seconds;
+    return m_idleSeconds;
+}
+
+void VoxelChunk::setIslandContext(uint32_t islandID, const ChunkCoord& chunkCoord)
 {
     m_islandID = islandID;
     m_chunkCoord = chunkCoord;
@@ -102,23 +158,110 @@ void VoxelChunk::addCollisionQuad(float x, float y, float z, int face)
 
     for (int i = 0; i < 4; ++i)
     {
-        collisionMeshVertices.push_back(Vec3(x, y, z) + quadVertices[face][i]);
+        m_build->collisionVertices.push_back(Vec3(x, y, z) + quadVertices[face][i]);
     }
 }
 
-bool VoxelChunk::isVoxelSolid(int x, int y, int z) const
+// Index of the lowest set bit (bits != 0)
+static inline int lowestSetBit(uint32_t bits)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+uint32_t VoxelChunk::meshedRowX(int y, int z) const
 {
-    uint8_t blockID = getVoxel(x, y, z);
-    if (blockID == BlockID::AIR) return false;
+    // OBJ blocks (instanced models) and air are not solid for meshing/collision purposes
+    return PaddedSnapshot::rowInBox(y, z) ? m_build->snapshot.meshedRowsX[PaddedSnapshot::rowIndex(y, z)] : 0;
+}
+
+uint32_t VoxelChunk::occupiedRowX(int y, int z) const
+{
+    return PaddedSnapshot::rowInBox(y, z) ? m_build->snapshot.occupiedRowsX[PaddedSnapshot::rowIndex(y, z)] : 0;
+}
+
+uint32_t VoxelChunk::occupiedRowZ(int x, int y) const
+{
+    return PaddedSnapshot::rowInBox(x, y) ? m_build->snapshot.occupiedRowsZ[PaddedSnapshot::rowIndex(x, y)] : 0;
+}
+
+uint8_t VoxelChunk::snapshotVoxel(int x, int y, int z) const
+{
+    if (x < -1 || x > SIZE || y < -1 || y > SIZE || z < -1 || z > SIZE)
+        return BlockID::AIR;
+    return m_build->snapshot.blockIDs[PaddedSnapshot::index(x, y, z)];
+}
+
+void VoxelChunk::buildPaddedSnapshot(PaddedSnapshot& snapshot) const
+{
+    PROFILE_SCOPE("VoxelChunk::buildPaddedSnapshot");
+    
+    // Padding defaults to air (missing neighbor = exposed)
+    snapshot.blockIDs.fill(BlockID::AIR);
+    
+    for (int z = 0; z < SIZE; ++z)
+        for (int y = 0; y < SIZE; ++y)
+            for (int x = 0; x < SIZE; ++x)
+                snapshot.blockIDs[PaddedSnapshot::index(x, y, z)] = voxels.get(x + y * SIZE + z * SIZE * SIZE);
     
-    // Check if this is an OBJ-type block (instanced models, not meshed voxels)
-    auto& registry = BlockTypeRegistry::getInstance();
-    const BlockTypeInfo* blockInfo = registry.getBlockType(blockID);
-    if (blockInfo && blockInfo->renderType == BlockRenderType::OBJ) {
-        return false;  // OBJ blocks are not solid for meshing/collision purposes
+    // Touching plane of each face neighbor: axis/direction per face (0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X)
+    static const int faceAxis[6] = {1, 1, 2, 2, 0, 0};
+    for (int face = 0; face < 6; ++face)
+    {
+        const VoxelChunk* neighbor = getNeighbor(face);
+        if (!neighbor)
+            continue;
+        
+        const int axis = faceAxis[face];
+        const int uAxis = (axis + 1) % 3;
+        const int vAxis = (axis + 2) % 3;
+        const bool positive = (face & 1) != 0;
+        
+        int dst[3];
+        int src[3];
+        dst[axis] = positive ? SIZE : -1;
+        src[axis] = positive ? 0 : SIZE - 1;
+        for (int v = 0; v < SIZE; ++v)
+        {
+            dst[vAxis] = src[vAxis] = v;
+            for (int u = 0; u < SIZE; ++u)
+            {
+                dst[uAxis] = src[uAxis] = u;
+                snapshot.blockIDs[PaddedSnapshot::index(dst[0], dst[1], dst[2])] =
+                    neighbor->getVoxel(src[0], src[1], src[2]);
+            }
+        }
     }
     
-    return true;
+    // Occupancy rows from the finished copy (padding planes included)
+    const auto& meshed = BlockTypeRegistry::getInstance().getPropertyTables().meshed;
+    snapshot.meshedRowsX.fill(0);
+    snapshot.occupiedRowsX.fill(0);
+    snapshot.occupiedRowsZ.fill(0);
+    for (int z = -1; z <= SIZE; ++z)
+    {
+        for (int y = -1; y <= SIZE; ++y)
+        {
+            const int rowX = PaddedSnapshot::rowIndex(y, z);
+            for (int x = -1; x <= SIZE; ++x)
+            {
+                const uint8_t blockID = snapshot.blockIDs[PaddedSnapshot::index(x, y, z)];
+                if (blockID == BlockID::AIR)
+                    continue;
+                
+                const uint32_t bitX = 1u << (x + PaddedSnapshot::ROW_BIT);
+                snapshot.occupiedRowsX[rowX] |= bitX;
+                snapshot.occupiedRowsZ[PaddedSnapshot::rowIndex(x, y)] |= 1u << (z + PaddedSnapshot::ROW_BIT);
+                if (meshed[blockID])
+                    snapshot.meshedRowsX[rowX] |= bitX;
+            }
+        }
+    }
 }
 
 void VoxelChunk::addQuadWithSharing(std::vector<Vertex>& vertices, std::vector<uint32_t>& indices,
@@ -140,18 +283,8 @@ void VoxelChunk::addQuadWithSharing(std::vector<Vertex>& vertices, std::vector<u
         // +X (right)
         {Vec3(1, 0, 0), Vec3(1, 1, 0), Vec3(1, 1, 1), Vec3(1, 0, 1)}};
 
-    // Normals for each face (MUST match order above)
-    static const Vec3 normals[6] = {
-        Vec3(0, -1, 0),  // -Y (bottom)
-        Vec3(0, 1, 0),   // +Y (top)
-        Vec3(0, 0, -1),  // -Z (back)
-        Vec3(0, 0, 1),   // +Z (front)
-        Vec3(-1, 0, 0),  // -X (left)
-        Vec3(1, 0, 0)    // +X (right)
-    };
-
     // Texture coordinates for each vertex of the quad
-    static const float texCoords[4][2] = {{0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}, {0.0f, 1.0f}};
+    static const int texCoords[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
 
     // Array to store indices for this quad's 4 vertices
     uint32_t quadIndices[4];
@@ -159,37 +292,14 @@ void VoxelChunk::addQuadWithSharing(std::vector<Vertex>& vertices, std::vector<u
     // Add 4 vertices for this quad (with deduplication)
     for (int i = 0; i < 4; ++i)
     {
-        Vertex v;
         Vec3 pos = Vec3(x, y, z) + quadVertices[face][i];
-        v.x = pos.x;
-        v.y = pos.y;
-        v.z = pos.z;
-        v.nx = normals[face].x;
-        v.ny = normals[face].y;
-        v.nz = normals[face].z;
-        v.u = texCoords[i][0];
-        v.v = texCoords[i][1];
-        
-        // Light mapping
-        switch (face)
-        {
-            case 0: case 1: // +Z/-Z faces: use X,Y
-                v.lu = (pos.x) / SIZE;
-                v.lv = (pos.y) / SIZE;
-                break;
-            case 2: case 3: // +Y/-Y faces: use X,Z
-                v.lu = (pos.x) / SIZE;
-                v.lv = (pos.z) / SIZE;
-                break;
-            case 4: case 5: // +X/-X faces: use Z,Y
-                v.lu = (pos.z) / SIZE;
-                v.lv = (pos.y) / SIZE;
-                break;
-        }
+        const int cx = static_cast<int>(pos.x);
+        const int cy = static_cast<int>(pos.y);
+        const int cz = static_cast<int>(pos.z);
         
-        v.ao = computeAmbientOcclusion(static_cast<int>(pos.x), static_cast<int>(pos.y), static_cast<int>(pos.z), face);
-        v.faceIndex = static_cast<float>(face);
-        v.blockType = static_cast<float>(blockType);  // ✅ FIX: Actually set the block type!
+        // Normal and light map UV are derived from face + position in the shader
+        Vertex v = Vertex::pack(cx, cy, cz, texCoords[i][0], texCoords[i][1], face,
+                                computeAmbientOcclusionLevel(cx, cy, cz, face), blockType);
         
         // Check if this vertex already exists in the cache
         auto it = vertexCache.find(v);
@@ -221,83 +331,116 @@ void VoxelChunk::generateMesh(bool generateLighting)
 {
     PROFILE_SCOPE("VoxelChunk::generateMesh");
     
-    auto startTime = std::chrono::high_resolution_clock::now();
-    (void)startTime; // Reserved for future timing metrics
+    auto build = prepareMeshBuild(generateLighting);
+    buildMesh(*build);
+    publishMeshBuild(*build);
+}
+
+std::unique_ptr<VoxelChunk::MeshBuild> VoxelChunk::prepareMeshBuild(bool generateLighting)
+{
+    auto build = std::make_unique<MeshBuild>();
+    build->requestID = m_meshRequestID.fetch_add(1, std::memory_order_acq_rel) + 1;
+    build->generateLighting = generateLighting && m_profile == ChunkProfile::Full;
     
-    std::lock_guard<std::mutex> lock(meshMutex);
-    mesh.vertices.clear();
-    mesh.indices.clear();
-    collisionMeshVertices.clear();
-    clearAllModelInstances();  // Clear all model instances before scanning
+    // One snapshot per remesh - the build never reads live voxels, neighbors or the island system
+    buildPaddedSnapshot(build->snapshot);
+    return build;
+}
+
+bool VoxelChunk::isMeshBuildStale(const MeshBuild& build) const
+{
+    return build.requestID != m_meshRequestID.load(std::memory_order_acquire);
+}
 
-    auto grassScanStart = std::chrono::high_resolution_clock::now();
-    (void)grassScanStart; // Reserved for future timing metrics
+bool VoxelChunk::buildMesh(MeshBuild& build)
+{
+    PROFILE_SCOPE("VoxelChunk::buildMesh");
     
+    // One build per chunk at a time (a superseded worker build may still be draining)
+    std::lock_guard<std::mutex> lock(m_buildMutex);
+    m_build = &build;
+
+    // Lean profile: collision only - no render mesh, AO, light maps or model instances
+    if (m_profile == ChunkProfile::Lean)
+    {
+        generateCollisionFaces();
+        buildCollisionMeshFromVertices();
+        m_build = nullptr;
+        return true;
+    }
+
     // Pre-scan for all OBJ-type blocks to create instance anchors (and ensure they are not meshed)
-    auto& registry = BlockTypeRegistry::getInstance();
+    const auto& objTable = BlockTypeRegistry::getInstance().getPropertyTables().obj;
     for (int z = 0; z < SIZE; ++z) {
         for (int y = 0; y < SIZE; ++y) {
             for (int x = 0; x < SIZE; ++x) {
-                uint8_t blockID = getVoxel(x, y, z);
-                if (blockID == BlockID::AIR) continue;
+                uint8_t blockID = snapshotVoxel(x, y, z);
                 
-                // Check if this is an OBJ-type block
-                const BlockTypeInfo* blockInfo = registry.getBlockType(blockID);
-                if (blockInfo && blockInfo->renderType == BlockRenderType::OBJ) {
+                // OBJ-type blocks become instance anchors (air and voxel blocks read false)
+                if (objTable[blockID]) {
                     // Position at block corner with X/Z centering, Y at ground level
                     Vec3 instancePos((float)x + 0.5f, (float)y, (float)z + 0.5f);
-                    addModelInstance(blockID, instancePos);
+                    build.modelInstances[blockID].push_back(instancePos);
                 }
             }
         }
     }
-    
-    auto greedyMeshStart = std::chrono::high_resolution_clock::now();
-    (void)greedyMeshStart; // Reserved for future timing metrics
 
-    // Simple mesh generation - one quad per exposed face
-    generateSimpleMesh();
-    
-    auto collisionStart = std::chrono::high_resolution_clock::now();
-    (void)collisionStart; // Reserved for future timing metrics
+    if (s_meshingMode == MeshingMode::Greedy)
+    {
+        generateGreedyMesh();
+        if (s_verifyMeshing)
+            verifyMeshCoverage();
+    }
+    else
+    {
+        // Simple mesh generation - one quad per exposed face
+        generateSimpleMesh();
+    }
     
     // Build collision mesh immediately after generating vertices
     buildCollisionMeshFromVertices();
     
-    auto lightingStart = std::chrono::high_resolution_clock::now();
-    (void)lightingStart; // Reserved for future timing metrics
-    
-    mesh.needsUpdate = true;
-    meshDirty = false;
-    
-    // NEW: Mark lighting as needing recalculation since geometry changed
-    lightingDirty = true;
+    // Superseded while meshing - skip the expensive light map pass, a newer build is queued
+    if (isMeshBuildStale(build))
+    {
+        m_build = nullptr;
+        return false;
+    }
     
     // CONDITIONAL LIGHTING GENERATION: Only generate if requested (skip during world gen)
-    if (generateLighting) {
+    if (build.generateLighting) {
         generatePerFaceLightMaps();
+    }
+    
+    m_build = nullptr;
+    return true;
+    
+    // Note: updateLightMapTextures() will be called during rendering when OpenGL context is available
+}
+
+void VoxelChunk::publishMeshBuild(MeshBuild& build)
+{
+    {
+        std::lock_guard<std::mutex> lock(meshMutex);
+        mesh.vertices.swap(build.vertices);
+        mesh.indices.swap(build.indices);
+        mesh.needsUpdate = true;
+        m_modelInstances.swap(build.modelInstances);
         
-        // Only initialize light maps if they're empty (preserve generated lighting data)
-        for (int face = 0; face < 6; ++face) {
-            FaceLightMap& faceMap = lightMaps.getFaceMap(face);
-            if (faceMap.data.empty()) {
-                faceMap.data.resize(32 * 32 * 3);
-                std::fill(faceMap.data.begin(), faceMap.data.end(), 255); // Full white default for unlit chunks
+        if (build.generateLighting) {
+            for (int face = 0; face < 6; ++face) {
+                lightMaps.getFaceMap(face).data.swap(build.lightMapData[face]);
             }
         }
-        
-        // Mark lighting as clean since we just generated it
-        lightingDirty = false;
     }
     
-    auto endTime = std::chrono::high_resolution_clock::now();
-    (void)endTime; // Reserved for future timing metrics
-    
-    // Note: Mesh generation profiling disabled to reduce console spam
-    // Timing: scan, greedy meshing, collision, lighting
-    // Can be re-enabled for performance debugging if needed
+    // Atomically update the collision mesh - safe for concurrent reads
+    setCollisionMesh(build.collision);
     
-    // Note: updateLightMapTextures() will be called during rendering when OpenGL context is available
+    meshDirty = false;
+    // Geometry changed: lighting is clean only if this build generated it
+    lightingDirty = m_profile == ChunkProfile::Full && !build.generateLighting;
 }
 
 void VoxelChunk::buildCollisionMeshFromVertices()
@@ -305,20 +448,20 @@ void VoxelChunk::buildCollisionMeshFromVertices()
     // Build collision mesh in a local variable, then atomically swap it in
     auto newMesh = std::make_shared<CollisionMesh>();
 
-    // Build collision faces from collisionMeshVertices
+    // Build collision faces from m_build->collisionVertices
     // Each quad (4 vertices) becomes one collision face
-    for (size_t i = 0; i < collisionMeshVertices.size(); i += 4)
+    for (size_t i = 0; i < m_build->collisionVertices.size(); i += 4)
     {
-        if (i + 3 >= collisionMeshVertices.size())
+        if (i + 3 >= m_build->collisionVertices.size())
             break;
 
         // Calculate face center and normal from the quad vertices
-        Vec3 v0 = collisionMeshVertices[i];
-        Vec3 v1 = collisionMeshVertices[i + 1];
-        Vec3 v2 = collisionMeshVertices[i + 2];
+        Vec3 v0 = m_build->collisionVertices[i];
+        Vec3 v1 = m_build->collisionVertices[i + 1];
+        Vec3 v2 = m_build->collisionVertices[i + 2];
 
         // Face center is average of vertices
-        Vec3 faceCenter = (v0 + v1 + v2 + collisionMeshVertices[i + 3]) * 0.25f;
+        Vec3 faceCenter = (v0 + v1 + v2 + m_build->collisionVertices[i + 3]) * 0.25f;
 
         // Face normal from cross product of edges
         Vec3 edge1 = v1 - v0;
@@ -327,16 +470,14 @@ void VoxelChunk::buildCollisionMeshFromVertices()
 
         newMesh->faces.push_back({faceCenter, normal});
     }
-    
-    // Atomically update the collision mesh - safe for concurrent reads
-    setCollisionMesh(newMesh);
-}
 
-void VoxelChunk::buildCollisionMesh()
-{
-    // Legacy method - now just calls the new implementation
-    std::lock_guard<std::mutex> lock(meshMutex);
-    buildCollisionMeshFromVertices();
+    // Occupancy grid straight from the snapshot's meshed rows (interior bits only)
+    for (int z = 0; z < SIZE; ++z)
+        for (int y = 0; y < SIZE; ++y)
+            newMesh->solidRows[y + z * SIZE] = static_cast<uint16_t>(meshedRowX(y, z) >> PaddedSnapshot::ROW_BIT);
+
+    // Published together with the render mesh by publishMeshBuild
+    m_build->collision = newMesh;
 }
 
 bool VoxelChunk::checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDirection,
@@ -465,10 +606,10 @@ static inline float vc_smoothNoise(float x, float z, uint32_t seed)
 }
 
 // Light mapping utilities
-float VoxelChunk::computeAmbientOcclusion(int x, int y, int z, int face) const
+int VoxelChunk::computeAmbientOcclusionLevel(int x, int y, int z, int face) const
 {
     // Simple ambient occlusion calculation based on neighboring voxels
-    // Higher values = more occlusion (darker), range [0.0, 1.0]
+    // Returns the number of occluding (non-air) neighbors, capped where shading bottoms out
     
     static const int faceOffsets[6][3] = {
         {0, 0, 1},   // +Z (front)
@@ -479,58 +620,40 @@ float VoxelChunk::computeAmbientOcclusion(int x, int y, int z, int face) const
         {-1, 0, 0}   // -X (left)
     };
     
-    // Get the face normal to determine which neighbors to check
-    int fx = faceOffsets[face][0];
-    int fy = faceOffsets[face][1];
-    int fz = faceOffsets[face][2];
+    // Plane of 3x3 cells one step along the face offset (center excluded), read as three
+    // 3-bit slices of occupancy rows. Plane axes per face: 0-1 (X,Y), 2-3 (X,Z), 4-5 (Z,Y).
+    const int cx = x + faceOffsets[face][0];
+    const int cy = y + faceOffsets[face][1];
+    const int cz = z + faceOffsets[face][2];
     
-    // Check 8 neighboring positions around this face
-    float occlusion = 0.0f;
-    int sampleCount = 0;
-    
-    // Create a 3x3 grid of offsets perpendicular to the face normal
-    for (int du = -1; du <= 1; du++)
+    uint32_t neighborhood = 0;  // Bit (du+1) + (dv+1)*3
+    for (int dv = -1; dv <= 1; ++dv)
     {
-        for (int dv = -1; dv <= 1; dv++)
-        {
-            if (du == 0 && dv == 0) continue; // Skip center
-            
-            int checkX = x, checkY = y, checkZ = z;
-            
-            // Map du,dv to world space based on face orientation
-            if (face <= 1) // Z faces: map to X,Y
-            {
-                checkX += du;
-                checkY += dv;
-            }
-            else if (face <= 3) // Y faces: map to X,Z
-            {
-                checkX += du;
-                checkZ += dv;
-            }
-            else // X faces: map to Z,Y
-            {
-                checkZ += du;
-                checkY += dv;
-            }
-            
-            // Also offset by face direction to check the neighboring voxels
-            checkX += fx;
-            checkY += fy;
-            checkZ += fz;
-            
-            // Sample the voxel at this position
-            if (getVoxel(checkX, checkY, checkZ) != 0)
-            {
-                occlusion += 0.15f; // Each solid neighbor adds occlusion
-            }
-            sampleCount++;
-        }
+        uint32_t row;
+        int along;
+        if (face <= 1)      { row = occupiedRowX(cy + dv, cz); along = cx; }
+        else if (face <= 3) { row = occupiedRowX(cy, cz + dv); along = cx; }
+        else                { row = occupiedRowZ(cx, cy + dv); along = cz; }
+        neighborhood |= ((row >> (along - 1 + PaddedSnapshot::ROW_BIT)) & 0x7u) << ((dv + 1) * 3);
     }
     
-    // Return ambient lighting factor (1.0 = bright, 0.0 = dark)
-    // Clamp to reasonable range for subtle effect
-    return std::max(0.3f, 1.0f - occlusion);
+    // Drop the center cell, leaving the 8-neighbor ring
+    const uint32_t ring = (neighborhood & 0xFu) | ((neighborhood >> 5) << 4);
+    
+    // Occluder count per ring mask; 5+ occluders all shade at the 0.3 floor, so one level
+    // keeps packed vertices and merge keys equal
+    static const std::array<uint8_t, 256> s_aoLevelLUT = [] {
+        std::array<uint8_t, 256> levels{};
+        for (int mask = 0; mask < 256; ++mask)
+        {
+            int occluders = 0;
+            for (int bit = 0; bit < 8; ++bit)
+                occluders += (mask >> bit) & 1;
+            levels[mask] = static_cast<uint8_t>(std::min(occluders, Vertex::MAX_AO_LEVEL));
+        }
+        return levels;
+    }();
+    return s_aoLevelLUT[ring];
 }
 
 void VoxelChunk::generatePerFaceLightMaps()
@@ -555,8 +678,8 @@ void VoxelChunk::generatePerFaceLightMaps()
     
     // Generate a light map for each face direction
     for (int faceIndex = 0; faceIndex < 6; ++faceIndex) {
-        FaceLightMap& faceMap = lightMaps.getFaceMap(faceIndex);
-        faceMap.data.resize(LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3);
+        std::vector<uint8_t>& faceData = m_build->lightMapData[faceIndex];
+        faceData.resize(LIGHTMAP_SIZE * LIGHTMAP_SIZE * 3);
         
         Vec3 faceNormal = faceNormals[faceIndex];
         
@@ -602,9 +725,9 @@ void VoxelChunk::generatePerFaceLightMaps()
                 // Store in light map (clamp to valid range)
                 int index = (v * LIGHTMAP_SIZE + u) * 3;
                 uint8_t lightByte = static_cast<uint8_t>(std::min(255.0f, std::max(0.0f, finalLight * 255.0f)));
-                faceMap.data[index] = lightByte;
-                faceMap.data[index + 1] = lightByte;
-                faceMap.data[index + 2] = lightByte;
+                faceData[index] = lightByte;
+                faceData[index + 1] = lightByte;
+                faceData[index + 2] = lightByte;
             }
         }
     }
@@ -671,7 +794,7 @@ bool VoxelChunk::performLocalSunRaycast(const Vec3& rayStart, const Vec3& sunDir
         voxelY = std::max(0, std::min(SIZE - 1, voxelY));
         voxelZ = std::max(0, std::min(SIZE - 1, voxelZ));
         
-        uint8_t voxel = getVoxel(voxelX, voxelY, voxelZ);
+        uint8_t voxel = snapshotVoxel(voxelX, voxelY, voxelZ);
         if (voxel != 0) {
             // Hit a solid voxel - ray is locally occluded
             return true;
@@ -703,19 +826,9 @@ bool VoxelChunk::performInterIslandSunRaycast(const Vec3& rayStart, const Vec3&
     // We need to find which island this chunk belongs to first
     extern IslandChunkSystem g_islandSystem;
     
-    // Find our island ID by checking all islands
-    uint32_t currentIslandID = 0;
+    // Our island comes from the island context (set when the chunk was created)
     const auto& islands = g_islandSystem.getIslands();
-    
-    for (const auto& [islandID, island] : islands) {
-        for (const auto& [chunkCoord, chunk] : island.chunks) {
-            if (chunk.get() == this) {
-                currentIslandID = islandID;
-                break;
-            }
-        }
-        if (currentIslandID != 0) break;
-    }
+    const uint32_t currentIslandID = islands.count(m_islandID) ? m_islandID : 0;
     
     if (currentIslandID == 0) {
         // Fallback to local raycast if we can't find our island
@@ -728,6 +841,31 @@ bool VoxelChunk::performInterIslandSunRaycast(const Vec3& rayStart, const Vec3&
     // Limit raycast steps for performance - use smaller range for inter-island checks
     const int limitedSteps = std::min(maxSteps, static_cast<int>(SIZE * 1.5f / stepSize));
     
+    // Only islands the ray's reach overlaps (broadphase), at most the 2 closest - pinned once per
+    // ray, not per step (islands are looked up unlocked already, so the unlocked accessor view matches)
+    const Vec3 worldRayStart = rayStart + islandCenter;
+    const float reach = limitedSteps * stepSize;
+    std::vector<uint32_t> candidates;
+    g_islandSystem.queryIslandsAlongRay(worldRayStart, sunDirection, reach, candidates);
+    std::vector<std::pair<float, const FloatingIsland*>> nearby;
+    for (uint32_t otherIslandID : candidates) {
+        if (otherIslandID == currentIslandID) continue;  // Skip our own island
+        auto it = islands.find(otherIslandID);
+        if (it != islands.end())
+            nearby.emplace_back((it->second.getPhysicsCenter() - worldRayStart).length(), &it->second);
+    }
+    std::sort(nearby.begin(), nearby.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    std::optional<VoxelAccessor> nearbyVoxels[2];
+    Vec3 nearbyCenters[2];
+    int nearbyCount = 0;
+    for (const auto& [distance, otherIsland] : nearby) {
+        nearbyVoxels[nearbyCount].emplace(*otherIsland);
+        nearbyCenters[nearbyCount] = otherIsland->getPhysicsCenter();
+        if (++nearbyCount == 2) break;
+    }
+    
     for (int step = 0; step < limitedSteps; ++step) {
         rayPos = rayPos + rayStep;
         
@@ -740,7 +878,7 @@ bool VoxelChunk::performInterIslandSunRaycast(const Vec3& rayStart, const Vec3&
             int voxelY = static_cast<int>(rayPos.y);
             int voxelZ = static_cast<int>(rayPos.z);
             
-            uint8_t voxel = getVoxel(voxelX, voxelY, voxelZ);
+            uint8_t voxel = snapshotVoxel(voxelX, voxelY, voxelZ);
             if (voxel != 0) {
                 return true;  // Hit local voxel
             }
@@ -748,22 +886,16 @@ bool VoxelChunk::performInterIslandSunRaycast(const Vec3& rayStart, const Vec3&
             // Only check nearby islands for efficiency
             Vec3 worldRayPos = rayPos + islandCenter;
             
-            // Check only the 2 closest islands to avoid O(n²) complexity
-            int islandsChecked = 0;
-            for (const auto& [otherIslandID, otherIsland] : islands) {
-                if (otherIslandID == currentIslandID) continue;  // Skip our own island
-                if (++islandsChecked > 2) break;  // Limit to 2 nearby islands
-                
+            for (int i = 0; i < nearbyCount; ++i) {
                 // Convert world position to island-relative position
-                Vec3 otherIslandCenter = g_islandSystem.getIslandCenter(otherIslandID);
-                Vec3 islandRelativePos = worldRayPos - otherIslandCenter;
+                Vec3 islandRelativePos = worldRayPos - nearbyCenters[i];
                 
                 // Quick distance check - skip if too far
                 float distToIsland = islandRelativePos.length();
                 if (distToIsland > SIZE * 2.0f) continue;
                 
                 // Query voxel from this island
-                uint8_t voxel = g_islandSystem.getVoxelFromIsland(otherIslandID, islandRelativePos);
+                uint8_t voxel = nearbyVoxels[i]->get(ChunkCoord::fromVec3(islandRelativePos));
                 if (voxel != 0) {
                     return true;  // Ray is occluded by another island's voxel
                 }
@@ -849,46 +981,23 @@ bool VoxelChunk::hasLightMapData() const {
 // UNIFIED CULLING - Works for intra-chunk AND inter-chunk
 // ========================================
 
-bool VoxelChunk::isFaceExposed(int x, int y, int z, int face) const
+uint32_t VoxelChunk::exposedFaceRow(int y, int z, int face) const
 {
     // STANDARD OpenGL/Minecraft face ordering for sanity:
     // 0=-Y(bottom), 1=+Y(top), 2=-Z(back), 3=+Z(front), 4=-X(left), 5=+X(right)
-    static const int dx[6] = { 0,  0,  0,  0, -1,  1};
-    static const int dy[6] = {-1,  1,  0,  0,  0,  0};
-    static const int dz[6] = { 0,  0, -1,  1,  0,  0};
-    
-    // Calculate neighbor position in LOCAL chunk space
-    int nx = x + dx[face];
-    int ny = y + dy[face];
-    int nz = z + dz[face];
-    
-    // Fast path: neighbor is within this chunk
-    if (nx >= 0 && nx < SIZE && ny >= 0 && ny < SIZE && nz >= 0 && nz < SIZE)
+    // Neighbor rows may sit in the padding planes (adjacent chunks) - same lookup either way
+    const uint32_t row = meshedRowX(y, z);
+    uint32_t covered;
+    switch (face)
     {
-        return !isVoxelSolid(nx, ny, nz);
+        case 0: covered = meshedRowX(y - 1, z); break;
+        case 1: covered = meshedRowX(y + 1, z); break;
+        case 2: covered = meshedRowX(y, z - 1); break;
+        case 3: covered = meshedRowX(y, z + 1); break;
+        case 4: covered = row << 1; break;  // Bit x now holds voxel x-1
+        default: covered = row >> 1; break; // Bit x now holds voxel x+1
     }
-    
-    // Slow path: neighbor is in adjacent chunk - query island system
-    if (m_islandID == 0 || !s_islandSystem) return true;  // No island context = always exposed
-    
-    // Calculate which neighbor chunk we need
-    Vec3 neighborChunkCoord = m_chunkCoord;
-    int localX = nx, localY = ny, localZ = nz;
-    
-    if (nx < 0) { neighborChunkCoord.x -= 1; localX = SIZE - 1; }
-    else if (nx >= SIZE) { neighborChunkCoord.x += 1; localX = 0; }
-    
-    if (ny < 0) { neighborChunkCoord.y -= 1; localY = SIZE - 1; }
-    else if (ny >= SIZE) { neighborChunkCoord.y += 1; localY = 0; }
-    
-    if (nz < 0) { neighborChunkCoord.z -= 1; localZ = SIZE - 1; }
-    else if (nz >= SIZE) { neighborChunkCoord.z += 1; localZ = 0; }
-    
-    // Query neighbor chunk
-    VoxelChunk* neighborChunk = s_islandSystem->getChunkFromIsland(m_islandID, neighborChunkCoord);
-    if (!neighborChunk) return true;  // Neighbor doesn't exist yet = exposed
-    
-    return !neighborChunk->isVoxelSolid(localX, localY, localZ);
+    return row & ~covered & PaddedSnapshot::INTERIOR_ROW;
 }
 
 // ========================================
@@ -902,27 +1011,20 @@ void VoxelChunk::generateSimpleMesh()
     // Vertex deduplication cache
     std::unordered_map<Vertex, uint32_t> vertexCache;
     
-    // Iterate through all voxels and generate faces for each direction
+    // Walk each X row once per face; only voxels with that face exposed come out of the mask
     for (int z = 0; z < SIZE; ++z)
     {
         for (int y = 0; y < SIZE; ++y)
         {
-            for (int x = 0; x < SIZE; ++x)
+            for (int face = 0; face < 6; ++face)
             {
-                // Skip air and OBJ-type blocks
-                if (!isVoxelSolid(x, y, z))
-                    continue;
-                
-                uint8_t blockType = getVoxel(x, y, z);
-                
-                // Generate ONLY exposed faces (unified culling!)
-                for (int face = 0; face < 6; ++face)
+                // ✅ UNIFIED CULLING - works for intra-chunk AND inter-chunk
+                for (uint32_t bits = exposedFaceRow(y, z, face); bits != 0; bits &= bits - 1)
                 {
-                    // ✅ UNIFIED CULLING - works for intra-chunk AND inter-chunk
-                    if (!isFaceExposed(x, y, z, face))
-                        continue;  // Skip hidden faces
+                    const int x = lowestSetBit(bits) - PaddedSnapshot::ROW_BIT;
+                    uint8_t blockType = snapshotVoxel(x, y, z);
                     
-                    addQuadWithSharing(mesh.vertices, mesh.indices, vertexCache,
+                    addQuadWithSharing(m_build->vertices, m_build->indices, vertexCache,
                            static_cast<float>(x), 
                            static_cast<float>(y), 
                            static_cast<float>(z), 
@@ -938,6 +1040,334 @@ void VoxelChunk::generateSimpleMesh()
     }
 }
 
+// ========================================
+// GREEDY MESH GENERATION
+// ========================================
+
+// Per-face axis layout: {normal, U, V} where U/V follow quadVertices winding (corner0->1 = U, corner0->3 = V)
+static const int s_greedyFaceAxes[6][3] = {
+    {1, 0, 2},  // -Y: U=X, V=Z
+    {1, 2, 0},  // +Y: U=Z, V=X
+    {2, 1, 0},  // -Z: U=Y, V=X
+    {2, 0, 1},  // +Z: U=X, V=Y
+    {0, 2, 1},  // -X: U=Z, V=Y
+    {0, 1, 2}   // +X: U=Y, V=Z
+};
+
+// Merge key layout: bits 0-7 block type, bits 8-19 four 3-bit corner AO levels, bit 20 uniform AO
+static constexpr uint32_t FACE_KEY_MERGEABLE = 1u << 20;
+
+uint32_t VoxelChunk::computeFaceMergeKey(int x, int y, int z, int face, uint8_t blockType) const
+{
+    // Same corner offsets as addQuadWithSharing so AO matches the simple mesher exactly
+    static const int cornerOffsets[6][4][3] = {
+        {{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}},
+        {{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}},
+        {{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}},
+        {{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+        {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}},
+        {{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}}};
+
+    uint32_t key = blockType;
+    uint32_t firstLevel = 0;
+    bool uniform = true;
+    for (int i = 0; i < 4; ++i)
+    {
+        uint32_t level = static_cast<uint32_t>(computeAmbientOcclusionLevel(x + cornerOffsets[face][i][0],
+                                                                            y + cornerOffsets[face][i][1],
+                                                                            z + cornerOffsets[face][i][2], face));
+        if (i == 0) firstLevel = level;
+        else if (level != firstLevel) uniform = false;
+        key |= level << (8 + i * 3);
+    }
+
+    // Only uniform-AO faces merge: interpolating a larger quad must not change shading
+    return uniform ? (key | FACE_KEY_MERGEABLE) : key;
+}
+
+void VoxelChunk::addGreedyQuad(int x, int y, int z, int face, int width, int height, uint8_t blockType)
+{
+    // Unit quad corners (same table as addQuadWithSharing), stretched along U/V by width/height
+    static const int quadVertices[6][4][3] = {
+        {{0, 0, 0}, {1, 0, 0}, {1, 0, 1}, {0, 0, 1}},
+        {{0, 1, 0}, {0, 1, 1}, {1, 1, 1}, {1, 1, 0}},
+        {{0, 0, 0}, {0, 1, 0}, {1, 1, 0}, {1, 0, 0}},
+        {{0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}},
+        {{0, 0, 0}, {0, 0, 1}, {0, 1, 1}, {0, 1, 0}},
+        {{1, 0, 0}, {1, 1, 0}, {1, 1, 1}, {1, 0, 1}}};
+
+    // Textures use GL_REPEAT, so UVs scale with quad size to tile one texture per block
+    static const int texCoords[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+
+    const int uAxis = s_greedyFaceAxes[face][1];
+    const int vAxis = s_greedyFaceAxes[face][2];
+    const int origin[3] = {x, y, z};
+
+    uint32_t baseIndex = static_cast<uint32_t>(m_build->vertices.size());
+    for (int i = 0; i < 4; ++i)
+    {
+        int corner[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            int offset = quadVertices[face][i][axis];
+            if (axis == uAxis) offset *= width;
+            else if (axis == vAxis) offset *= height;
+            corner[axis] = origin[axis] + offset;
+        }
+
+        // Light map UV stays linear in position (derived in the shader, same as addQuadWithSharing)
+        Vertex v = Vertex::pack(corner[0], corner[1], corner[2], texCoords[i][0] * width, texCoords[i][1] * height,
+                                face, computeAmbientOcclusionLevel(corner[0], corner[1], corner[2], face), blockType);
+        m_build->vertices.push_back(v);
+    }
+
+    m_build->indices.push_back(baseIndex);
+    m_build->indices.push_back(baseIndex + 1);
+    m_build->indices.push_back(baseIndex + 2);
+    m_build->indices.push_back(baseIndex);
+    m_build->indices.push_back(baseIndex + 2);
+    m_build->indices.push_back(baseIndex + 3);
+}
+
+void VoxelChunk::generateGreedyMesh()
+{
+    PROFILE_SCOPE("VoxelChunk::generateGreedyMesh");
+
+    // One 2D mask per slice: 0 = no face, otherwise the merge key of the exposed face
+    std::array<uint32_t, SIZE * SIZE> mask;
+    // Exposed-face bit rows (along X) for the current face, indexed y + z * SIZE
+    std::array<uint32_t, SIZE * SIZE> exposedRows;
+
+    for (int face = 0; face < 6; ++face)
+    {
+        const int normalAxis = s_greedyFaceAxes[face][0];
+        const int uAxis = s_greedyFaceAxes[face][1];
+        const int vAxis = s_greedyFaceAxes[face][2];
+
+        uint32_t anyExposed = 0;
+        for (int z = 0; z < SIZE; ++z)
+            for (int y = 0; y < SIZE; ++y)
+                anyExposed |= exposedRows[y + z * SIZE] = exposedFaceRow(y, z, face);
+        if (anyExposed == 0)
+            continue;
+
+        for (int slice = 0; slice < SIZE; ++slice)
+        {
+            // Build mask from the exposed rows crossing this slice - same exposure rule as generateSimpleMesh
+            mask.fill(0);
+            bool anyFace = false;
+            int pos[3];
+            const int zBegin = normalAxis == 2 ? slice : 0;
+            const int zEnd = normalAxis == 2 ? slice + 1 : SIZE;
+            const int yBegin = normalAxis == 1 ? slice : 0;
+            const int yEnd = normalAxis == 1 ? slice + 1 : SIZE;
+            const uint32_t sliceBits = normalAxis == 0 ? 1u << (slice + PaddedSnapshot::ROW_BIT) : ~0u;
+            for (int z = zBegin; z < zEnd; ++z)
+            {
+                for (int y = yBegin; y < yEnd; ++y)
+                {
+                    for (uint32_t bits = exposedRows[y + z * SIZE] & sliceBits; bits != 0; bits &= bits - 1)
+                    {
+                        pos[0] = lowestSetBit(bits) - PaddedSnapshot::ROW_BIT;
+                        pos[1] = y;
+                        pos[2] = z;
+
+                        // Collision stays one quad per voxel face
+                        addCollisionQuad(static_cast<float>(pos[0]), static_cast<float>(pos[1]),
+                                         static_cast<float>(pos[2]), face);
+
+                        mask[pos[uAxis] + pos[vAxis] * SIZE] =
+                            computeFaceMergeKey(pos[0], pos[1], pos[2], face, snapshotVoxel(pos[0], pos[1], pos[2]));
+                        anyFace = true;
+                    }
+                }
+            }
+
+            if (!anyFace)
+                continue;
+
+            pos[normalAxis] = slice;
+
+            // Merge rectangles: extend along U, then grow along V while whole rows match
+            for (int v = 0; v < SIZE; ++v)
+            {
+                for (int u = 0; u < SIZE; ++u)
+                {
+                    const uint32_t key = mask[u + v * SIZE];
+                    if (key == 0)
+                        continue;
+
+                    int width = 1;
+                    int height = 1;
+                    if (key & FACE_KEY_MERGEABLE)
+                    {
+                        while (u + width < SIZE && mask[(u + width) + v * SIZE] == key)
+                            ++width;
+
+                        while (v + height < SIZE)
+                        {
+                            bool rowMatches = true;
+                            for (int k = 0; k < width; ++k)
+                            {
+                                if (mask[(u + k) + (v + height) * SIZE] != key)
+                                {
+                                    rowMatches = false;
+                                    break;
+                                }
+                            }
+                            if (!rowMatches)
+                                break;
+                            ++height;
+                        }
+                    }
+
+                    for (int dv = 0; dv < height; ++dv)
+                        for (int du = 0; du < width; ++du)
+                            mask[(u + du) + (v + dv) * SIZE] = 0;
+
+                    pos[uAxis] = u;
+                    pos[vAxis] = v;
+                    addGreedyQuad(pos[0], pos[1], pos[2], face, width, height,
+                                  static_cast<uint8_t>(key & 0xFFu));
+                }
+            }
+        }
+    }
+}
+
+// ========================================
+// MESH VERIFICATION - greedy vs simple surface coverage
+// ========================================
+
+size_t VoxelChunk::rasterizeMeshCoverage(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                         std::vector<uint8_t>& coverage) const
+{
+    // coverage[face * VOLUME + voxelIndex] = block type of the quad covering that voxel face (0 = uncovered)
+    static const int normalAxisForFace[6] = {1, 1, 2, 2, 0, 0};
+
+    coverage.assign(6 * VOLUME, 0);
+    size_t overlaps = 0;
+
+    // Both meshers emit quads as 6 indices: (0,1,2) (0,2,3)
+    for (size_t q = 0; q + 5 < indices.size(); q += 6)
+    {
+        const uint32_t corners[4] = {indices[q], indices[q + 1], indices[q + 2], indices[q + 5]};
+        const Vertex& first = vertices[corners[0]];
+        const int face = first.face();
+        const uint8_t blockType = first.blockType();
+
+        int minC[3] = {SIZE + 1, SIZE + 1, SIZE + 1};
+        int maxC[3] = {-1, -1, -1};
+        for (uint32_t idx : corners)
+        {
+            const int c[3] = {vertices[idx].x(), vertices[idx].y(), vertices[idx].z()};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                minC[axis] = std::min(minC[axis], c[axis]);
+                maxC[axis] = std::max(maxC[axis], c[axis]);
+            }
+        }
+
+        // Face plane -> voxel layer (positive faces sit on the far side of their voxel)
+        const int normalAxis = normalAxisForFace[face];
+        const int layer = (face & 1) ? minC[normalAxis] - 1 : minC[normalAxis];
+        minC[normalAxis] = layer;
+        maxC[normalAxis] = layer + 1;
+
+        for (int z = minC[2]; z < maxC[2]; ++z)
+        {
+            for (int y = minC[1]; y < maxC[1]; ++y)
+            {
+                for (int x = minC[0]; x < maxC[0]; ++x)
+                {
+                    if (x < 0 || x >= SIZE || y < 0 || y >= SIZE || z < 0 || z >= SIZE)
+                    {
+                        ++overlaps;  // Quad leaks outside the chunk
+                        continue;
+                    }
+                    uint8_t& cell = coverage[face * VOLUME + x + y * SIZE + z * SIZE * SIZE];
+                    if (cell != 0)
+                        ++overlaps;
+                    cell = blockType;
+                }
+            }
+        }
+    }
+
+    return overlaps;
+}
+
+bool VoxelChunk::verifyMeshCoverage()
+{
+    PROFILE_SCOPE("VoxelChunk::verifyMeshCoverage");
+
+    std::vector<uint8_t> greedyCoverage;
+    std::vector<uint8_t> simpleCoverage;
+    const size_t overlaps = rasterizeMeshCoverage(m_build->vertices, m_build->indices, greedyCoverage);
+
+    // Run the reference mesher into the live buffers, then restore the greedy result
+    std::vector<Vertex> greedyVertices;
+    std::vector<uint32_t> greedyIndices;
+    std::vector<Vec3> greedyCollision;
+    greedyVertices.swap(m_build->vertices);
+    greedyIndices.swap(m_build->indices);
+    greedyCollision.swap(m_build->collisionVertices);
+
+    generateSimpleMesh();
+    rasterizeMeshCoverage(m_build->vertices, m_build->indices, simpleCoverage);
+    const size_t simpleCollisionVerts = m_build->collisionVertices.size();
+    const size_t simpleQuads = m_build->indices.size() / 6;
+
+    m_build->vertices.swap(greedyVertices);
+    m_build->indices.swap(greedyIndices);
+    m_build->collisionVertices.swap(greedyCollision);
+
+    size_t missing = 0, extra = 0, wrongType = 0;
+    for (size_t i = 0; i < greedyCoverage.size(); ++i)
+    {
+        if (greedyCoverage[i] == simpleCoverage[i]) continue;
+        if (greedyCoverage[i] == 0) ++missing;
+        else if (simpleCoverage[i] == 0) ++extra;
+        else ++wrongType;
+    }
+
+    const bool collisionMatches = simpleCollisionVerts == m_build->collisionVertices.size();
+    if (missing == 0 && extra == 0 && wrongType == 0 && overlaps == 0 && collisionMatches)
+        return true;
+
+    std::cerr << "⚠️  Greedy mesh verification FAILED (island " << m_islandID << ", chunk "
+              << m_chunkCoord.x << "," << m_chunkCoord.y << "," << m_chunkCoord.z << "): "
+              << missing << " missing, " << extra << " extra, " << wrongType << " wrong type, "
+              << overlaps << " overlapping faces, collision " << m_build->collisionVertices.size() / 4
+              << "/" << simpleCollisionVerts / 4 << " (greedy " << m_build->indices.size() / 6
+              << " quads vs simple " << simpleQuads << ")" << std::endl;
+    return false;
+}
+
+void VoxelChunk::generateCollisionFaces()
+{
+    PROFILE_SCOPE("VoxelChunk::generateCollisionFaces");
+    
+    // Same exposure rule as the render meshers, one collision quad per exposed voxel face
+    for (int z = 0; z < SIZE; ++z)
+    {
+        for (int y = 0; y < SIZE; ++y)
+        {
+            for (int face = 0; face < 6; ++face)
+            {
+                for (uint32_t bits = exposedFaceRow(y, z, face); bits != 0; bits &= bits - 1)
+                {
+                    const int x = lowestSetBit(bits) - PaddedSnapshot::ROW_BIT;
+                    addCollisionQuad(static_cast<float>(x), 
+                                   static_cast<float>(y), 
+                                   static_cast<float>(z), 
+                                   face);
+                }
+            }
+        }
+    }
+}
+
 // Model instance management (for BlockRenderType::OBJ blocks)
 const std::vector<Vec3>& VoxelChunk::getModelInstances(uint8_t blockID) const
 {
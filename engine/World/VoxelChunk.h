@@ -3,6 +3,8 @@
 
 #include "../Math/Vec3.h"
 #include "BlockType.h"
+#include "VoxelPaletteStorage.h"
+#include "ChunkCoord.h"
 #include <array>
 #include <vector>
 #include <unordered_map>
@@ -15,44 +17,56 @@
 // Forward declaration for OpenGL types
 using GLuint = uint32_t;
 
+// Packed chunk vertex - 8 bytes, decoded by the MDI vertex shader (SimpleShader.cpp)
+//   geometry: x | y << 5 | z << 10 | u << 15 | v << 20 | face << 25 | aoLevel << 28
+//             x/y/z chunk-local corner (0..16), u/v texture repeat (0..16), face 0-5, AO level 0-5
+//   material: block type ID in bits 0-7 (rest reserved)
+// Normal, light map UV and AO factor are derived from face/position/aoLevel instead of stored.
 struct Vertex
 {
-    float x, y, z;     // Position
-    float nx, ny, nz;  // Normal
-    float u, v;        // Texture coordinates
-    float lu, lv;      // Light map coordinates
-    float ao;          // Ambient occlusion (0.0 = fully occluded, 1.0 = no occlusion)
-    float faceIndex;   // Face index (0-5) for selecting correct light map texture
-    float blockType;   // Block type ID for texture selection
-    
+    uint32_t geometry = 0;
+    uint32_t material = 0;
+
+    static constexpr size_t UNPACKED_SIZE = 13 * sizeof(float);  // Previous float layout, for memory stats
+    static constexpr int MAX_AO_LEVEL = 5;  // Occluding neighbors; 5+ all shade at the 0.3 floor
+
+    static Vertex pack(int x, int y, int z, int u, int v, int face, int aoLevel, uint8_t blockType)
+    {
+        Vertex vertex;
+        vertex.geometry = static_cast<uint32_t>(x) | (static_cast<uint32_t>(y) << 5) |
+                          (static_cast<uint32_t>(z) << 10) | (static_cast<uint32_t>(u) << 15) |
+                          (static_cast<uint32_t>(v) << 20) | (static_cast<uint32_t>(face) << 25) |
+                          (static_cast<uint32_t>(aoLevel) << 28);
+        vertex.material = blockType;
+        return vertex;
+    }
+
+    int x() const { return geometry & 0x1F; }
+    int y() const { return (geometry >> 5) & 0x1F; }
+    int z() const { return (geometry >> 10) & 0x1F; }
+    int u() const { return (geometry >> 15) & 0x1F; }
+    int v() const { return (geometry >> 20) & 0x1F; }
+    int face() const { return (geometry >> 25) & 0x7; }
+    int aoLevel() const { return (geometry >> 28) & 0x7; }
+    uint8_t blockType() const { return static_cast<uint8_t>(material & 0xFF); }
+
+    // Same curve the shader applies: 1.0 unoccluded, -0.15 per occluder, floor 0.3
+    float ambientOcclusion() const { return aoLevel() >= MAX_AO_LEVEL ? 0.3f : 1.0f - 0.15f * aoLevel(); }
+
     // Equality operator for vertex deduplication
-    bool operator==(const Vertex& other) const {
-        return x == other.x && y == other.y && z == other.z &&
-               nx == other.nx && ny == other.ny && nz == other.nz &&
-               u == other.u && v == other.v &&
-               lu == other.lu && lv == other.lv &&
-               ao == other.ao && faceIndex == other.faceIndex &&
-               blockType == other.blockType;
+    bool operator==(const Vertex& other) const
+    {
+        return geometry == other.geometry && material == other.material;
     }
 };
+static_assert(sizeof(Vertex) == 8, "Vertex must stay packed - MDI attribute layout depends on it");
 
 // Hash function for Vertex
 namespace std {
     template<>
     struct hash<Vertex> {
         size_t operator()(const Vertex& v) const {
-            // Combine hashes of all fields
-            size_t h1 = hash<float>()(v.x);
-            size_t h2 = hash<float>()(v.y);
-            size_t h3 = hash<float>()(v.z);
-            size_t h4 = hash<float>()(v.nx);
-            size_t h5 = hash<float>()(v.ny);
-            size_t h6 = hash<float>()(v.nz);
-            size_t h7 = hash<float>()(v.u);
-            size_t h8 = hash<float>()(v.v);
-            // Combine using XOR and bit shifting
-            return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3) ^ 
-                   (h5 << 4) ^ (h6 << 5) ^ (h7 << 6) ^ (h8 << 7);
+            return (static_cast<uint64_t>(v.material) << 32 | v.geometry) * 0x9E3779B97F4A7C15ull >> 16;
         }
     };
 }
@@ -110,12 +124,16 @@ struct CollisionFace
 struct CollisionMesh
 {
     std::vector<CollisionFace> faces;
+    // Occupancy grid of the same build: bit x of row (y + z * 16) is set for each solid voxel
+    // (non-air, non-OBJ - the voxels that produce faces). Lets capsule tests visit only the cells they overlap.
+    std::array<uint16_t, 16 * 16> solidRows{};
     
     CollisionMesh() = default;
-    CollisionMesh(const CollisionMesh& other) : faces(other.faces) {}
+    CollisionMesh(const CollisionMesh& other) : faces(other.faces), solidRows(other.solidRows) {}
     CollisionMesh& operator=(const CollisionMesh& other) {
         if (this != &other) {
             faces = other.faces;
+            solidRows = other.solidRows;
         }
         return *this;
     }
@@ -123,18 +141,38 @@ struct CollisionMesh
 
 class IslandChunkSystem;  // Forward declaration
 
+// Chunk profile - what a chunk builds when its voxels change
+enum class ChunkProfile : uint8_t
+{
+    Full,  // Render mesh, AO, light maps, model instances + collision (client)
+    Lean   // Voxel data + collision only (headless server - nothing is ever drawn)
+};
+
 class VoxelChunk
 {
    public:
     static constexpr int SIZE = 16;  // 16x16x16 chunks
     static constexpr int VOLUME = SIZE * SIZE * SIZE;
-    
-    // Static island system pointer for inter-chunk queries
-    static void setIslandSystem(IslandChunkSystem* system) { s_islandSystem = system; }
 
-    VoxelChunk();
+
+    // Meshing strategy - build default from ENGINE_GREEDY_MESHING, switchable at runtime
+    enum class MeshingMode : uint8_t
+    {
+        Simple,  // One quad per exposed face (reference mesher)
+        Greedy   // Coplanar faces with same block type and AO merged into rectangles
+    };
+    static void setMeshingMode(MeshingMode mode) { s_meshingMode = mode; }
+    static MeshingMode getMeshingMode() { return s_meshingMode; }
+
+    // Correctness mode: every greedy mesh is checked against the simple mesher's surface
+    static void setMeshVerification(bool enabled) { s_verifyMeshing = enabled; }
+    static bool isMeshVerificationEnabled() { return s_verifyMeshing; }
+
+    explicit VoxelChunk(ChunkProfile profile = ChunkProfile::Full);
     ~VoxelChunk();
 
+    ChunkProfile getProfile() const { return m_profile; }
+
     // Voxel data access (ID-based - clean and efficient)
     uint8_t getVoxel(int x, int y, int z) const;
     void setVoxel(int x, int y, int z, uint8_t type);
@@ -144,25 +182,50 @@ class VoxelChunk
     void setBlockID(int x, int y, int z, uint8_t blockID) { setVoxel(x, y, z, blockID); }
     bool hasBlockID(int x, int y, int z, uint8_t blockID) const { return getVoxel(x, y, z) == blockID; }
 
-    // Network serialization - get raw voxel data for transmission
-    const uint8_t* getRawVoxelData() const
-    {
-        return voxels.data();
-    }
-    
     // Network serialization helpers
     void setRawVoxelData(const uint8_t* data, uint32_t size);
+    void copyRawVoxelData(uint8_t* out) const { voxels.copyTo(out); }  // VOLUME bytes, no cached decode
     uint32_t getVoxelDataSize() const { return VOLUME; }
+    
+    // Palette storage state
+    bool isUniform() const { return voxels.isUniform(); }
+    size_t getVoxelMemoryUsage() const { return sizeof(VoxelPaletteStorage) + voxels.getMemoryUsage(); }
+    size_t getMemoryUsage() const;  // Whole chunk: object, voxels, mesh, light maps, collision (by capacity)
+    void compactVoxelStorage() { voxels.compact(); }  // Repack after bulk edits (e.g. world generation)
 
-    // Mesh generation and management
+    // Mesh generation and management (synchronous: prepare + build + publish on the calling thread)
     void generateMesh(bool generateLighting = true);
 
+    // Split remesh for background workers (see MeshWorkerPool):
+    //   prepareMeshBuild - owner thread, snapshots voxels + neighbor planes, supersedes older builds
+    //   buildMesh        - any thread, writes only the MeshBuild; false if superseded mid-build
+    //   publishMeshBuild - swaps the back buffer into the live mesh/collision/light maps
+    struct MeshBuild;
+    std::unique_ptr<MeshBuild> prepareMeshBuild(bool generateLighting = true);
+    bool buildMesh(MeshBuild& build);
+    void publishMeshBuild(MeshBuild& build);
+    bool isMeshBuildStale(const MeshBuild& build) const;
+
     // Mesh state
     bool isDirty() const
     {
         return meshDirty;
     }
 
+    // World save: set by every voxel write, cleared once the chunk matches what is on disk
+    bool hasUnsavedChanges() const { return m_unsavedChanges; }
+    void markSaved() { m_unsavedChanges = false; }
+
+    // Connectivity cache (IslandConnectivity): changes on every voxel write and is never shared by two
+    // chunk objects, so a cached labelling can't be mistaken for a newer chunk at the same coordinate
+    uint64_t getVoxelVersion() const { return m_voxelVersion; }
+
+    // Residency (IslandChunkSystem cold tier): seconds since the chunk was last written or inside a
+    // player's working set. Advanced by the streaming update only; every voxel write restarts it.
+    float advanceIdleTime(float seconds);
+    float getIdleTime() const { return m_idleSeconds; }
+    void resetIdleTime() { m_idleSeconds = 0.0f; m_writtenSinceIdleCheck = false; }
+
     // **LOD AND CULLING SUPPORT**
     int calculateLOD(const Vec3& cameraPos) const;
     bool shouldRender(const Vec3& cameraPos, float maxDistance = 1024.0f) const;
@@ -212,32 +275,72 @@ class VoxelChunk
     // Light mapping utilities - public for GlobalLightingManager
     Vec3 calculateWorldPositionFromLightMapUV(int faceIndex, float u, float v) const;  // Convert UV to world pos
     
-    void buildCollisionMesh();
-    void buildCollisionMeshFromVertices();  // Internal method called during generateMesh()
     bool checkRayCollision(const Vec3& rayOrigin, const Vec3& rayDirection, float maxDistance,
                            Vec3& hitPoint, Vec3& hitNormal) const;
 
    public:
     // Island context for inter-chunk culling
-    void setIslandContext(uint32_t islandID, const Vec3& chunkCoord);
+    void setIslandContext(uint32_t islandID, const ChunkCoord& chunkCoord);
+    
+    // Face-adjacent chunks in the same island (0=-Y, 1=+Y, 2=-Z, 3=+Z, 4=-X, 5=+X)
+    // Maintained by IslandChunkSystem on chunk add/remove; read by meshing without any lock
+    void setNeighbor(int face, VoxelChunk* neighbor) { m_neighbors[face].store(neighbor, std::memory_order_release); }
+    VoxelChunk* getNeighbor(int face) const { return m_neighbors[face].load(std::memory_order_acquire); }
     
 
    private:
-    std::array<uint8_t, VOLUME> voxels;
+    VoxelPaletteStorage voxels;  // Palette-compressed, uniform chunks allocate nothing
     VoxelMesh mesh;
     mutable std::mutex meshMutex;
     std::shared_ptr<CollisionMesh> collisionMesh;  // Thread-safe atomic access via getCollisionMesh/setCollisionMesh
     ChunkLightMaps lightMaps;  // NEW: Per-face light mapping data
     bool meshDirty = true;
     bool lightingDirty = true;  // NEW: Lighting needs recalculation
+    bool m_unsavedChanges = true;  // A new chunk has never been saved
+    bool m_writtenSinceIdleCheck = false;
+    uint64_t m_voxelVersion;  // Unique base per chunk (high 32 bits) + write count
+    float m_idleSeconds = 0.0f;
     int mdiIndex = -1;  // Index in MDI renderer for transform updates (-1 = not registered)
     
+    ChunkProfile m_profile = ChunkProfile::Full;
+    
     // Island context for inter-chunk culling
     uint32_t m_islandID = 0;
-    Vec3 m_chunkCoord{0, 0, 0};
+    ChunkCoord m_chunkCoord{0, 0, 0};
+    std::array<std::atomic<VoxelChunk*>, 6> m_neighbors{};
     
-    // Static island system for inter-chunk queries
-    static IslandChunkSystem* s_islandSystem;
+    // 18x18x18 copy of this chunk plus the touching plane of each face neighbor.
+    // Built once per remesh so culling and AO read local memory only.
+    // Occupancy is also kept as bit rows (coord c -> bit c + ROW_BIT, coords -1..SIZE) so a whole
+    // row of 16 voxels is culled with one shift + AND-NOT; rows outside the padded box read empty.
+    struct PaddedSnapshot
+    {
+        static constexpr int DIM = SIZE + 2;
+        static constexpr int ROW_BIT = 2;  // Lets AO read coord-1 at coord -1 without a negative shift
+        static constexpr uint32_t INTERIOR_ROW = ((1u << SIZE) - 1u) << ROW_BIT;
+        std::array<uint8_t, DIM * DIM * DIM> blockIDs;
+        std::array<uint32_t, DIM * DIM> meshedRowsX;    // Per (y,z), along X: non-air, non-OBJ (culling)
+        std::array<uint32_t, DIM * DIM> occupiedRowsX;  // Per (y,z), along X: non-air (AO)
+        std::array<uint32_t, DIM * DIM> occupiedRowsZ;  // Per (x,y), along Z: non-air (AO)
+        static int index(int x, int y, int z) { return (x + 1) + (y + 1) * DIM + (z + 1) * DIM * DIM; }
+        static int rowIndex(int a, int b) { return (a + 1) + (b + 1) * DIM; }
+        static bool rowInBox(int a, int b) { return a >= -1 && a <= SIZE && b >= -1 && b <= SIZE; }
+    };
+    void buildPaddedSnapshot(PaddedSnapshot& snapshot) const;
+    uint8_t snapshotVoxel(int x, int y, int z) const;  // Air outside the padded box
+    uint32_t meshedRowX(int y, int z) const;
+    uint32_t occupiedRowX(int y, int z) const;
+    uint32_t occupiedRowZ(int x, int y) const;
+
+    // Remesh in progress - only valid inside buildMesh (m_buildMutex held)
+    MeshBuild* m_build = nullptr;
+    std::mutex m_buildMutex;
+    std::atomic<uint32_t> m_meshRequestID{0};  // Bumped per prepareMeshBuild; older builds are stale
+    void buildCollisionMeshFromVertices();
+
+    // Meshing strategy and verification toggle (shared by all chunks)
+    static MeshingMode s_meshingMode;
+    static bool s_verifyMeshing;
 
     // NEW: Per-block-type model instance positions (for BlockRenderType::OBJ blocks)
     // Key: BlockID, Value: list of instance positions within this chunk
@@ -248,21 +351,47 @@ class VoxelChunk
                             std::unordered_map<Vertex, uint32_t>& vertexCache,
                             float x, float y, float z, int face, uint8_t blockType);
     void addCollisionQuad(float x, float y, float z, int face);
-    bool isVoxelSolid(int x, int y, int z) const;
     
-    // Unified culling - works for intra-chunk AND inter-chunk
-    bool isFaceExposed(int x, int y, int z, int face) const;
+    // Unified culling - works for intra-chunk AND inter-chunk (padded snapshot, no lock)
+    // Bit (x + ROW_BIT) set for each meshed voxel in row (y,z) whose face is exposed
+    uint32_t exposedFaceRow(int y, int z, int face) const;
     
     // Simple meshing implementation
     void generateSimpleMesh();
     
+    // Lean profile: exposed-face collision quads only, no render vertices
+    void generateCollisionFaces();
+    
+    // Greedy meshing implementation - collision stays per voxel face (physics assumes 1x1 faces)
+    void generateGreedyMesh();
+    void addGreedyQuad(int x, int y, int z, int face, int width, int height, uint8_t blockType);
+    uint32_t computeFaceMergeKey(int x, int y, int z, int face, uint8_t blockType) const;
+    
+    // Correctness mode - compares the build's mesh surface against the simple mesher
+    bool verifyMeshCoverage();
+    size_t rasterizeMeshCoverage(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices,
+                                 std::vector<uint8_t>& coverage) const;
+    
     // Light mapping utilities
-    float computeAmbientOcclusion(int x, int y, int z, int face) const;
+    int computeAmbientOcclusionLevel(int x, int y, int z, int face) const;  // Occluding neighbors, capped at Vertex::MAX_AO_LEVEL
     void generatePerFaceLightMaps();  // Generate separate light map per face direction
     bool performSunRaycast(const Vec3& rayStart, const Vec3& sunDirection, float maxDistance) const;  // Raycast for occlusion
     bool performLocalSunRaycast(const Vec3& rayStart, const Vec3& sunDirection, float maxDistance) const;  // Local chunk raycast for floating islands
     bool performInterIslandSunRaycast(const Vec3& rayStart, const Vec3& sunDirection, float maxDistance) const;  // Inter-island raycast for lighting
-    
-    std::vector<Vec3>
-        collisionMeshVertices;  // Collision mesh: stores positions of exposed faces for physics
+};
+
+// Back buffer for one remesh - filled without touching the published mesh, so a worker
+// can build while the render thread keeps drawing (and physics keeps colliding with) the old one
+struct VoxelChunk::MeshBuild
+{
+    PaddedSnapshot snapshot;   // Voxel input, captured by prepareMeshBuild
+    uint32_t requestID = 0;    // Matches m_meshRequestID until a newer remesh is requested
+    bool generateLighting = true;
+
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<Vec3> collisionVertices;  // 4 corners per exposed face, folded into collision
+    std::shared_ptr<CollisionMesh> collision;
+    std::unordered_map<uint8_t, std::vector<Vec3>> modelInstances;
+    std::array<std::vector<uint8_t>, 6> lightMapData;
 };
@@ -0,0 +1,163 @@
+// VoxelPaletteStorage.cpp - Palette-compressed block storage implementation
+#include "VoxelPaletteStorage.h"
+
+#include <algorithm>
+#include <cstring>
+
+uint8_t VoxelPaletteStorage::bitsForPaletteSize(int paletteSize)
+{
+    if (paletteSize <= 1) return 0;
+    if (paletteSize <= 2) return 1;
+    if (paletteSize <= 4) return 2;
+    if (paletteSize <= 16) return 4;
+    return 8;
+}
+
+void VoxelPaletteStorage::encode(const uint8_t* blockIDs, uint8_t bitsPerIndex, const uint8_t* palette, int paletteSize)
+{
+    m_bitsPerIndex = bitsPerIndex;
+
+    if (bitsPerIndex == 0)
+    {
+        m_uniformValue = paletteSize > 0 ? palette[0] : 0;
+        m_paletteSize = 0;
+        std::vector<uint8_t>().swap(m_data);
+        return;
+    }
+
+    if (bitsPerIndex == 8)
+    {
+        m_paletteSize = 0;
+        m_data.assign(blockIDs, blockIDs + VOLUME);
+        return;
+    }
+
+    // Block ID -> palette index lookup (palette has at most 16 entries)
+    uint8_t lookup[256] = {};
+    for (int i = 0; i < paletteSize; ++i)
+    {
+        m_palette[i] = palette[i];
+        lookup[palette[i]] = static_cast<uint8_t>(i);
+    }
+    m_paletteSize = static_cast<uint8_t>(paletteSize);
+
+    m_data.assign(VOLUME * bitsPerIndex / 8, 0);
+    for (int i = 0; i < VOLUME; ++i)
+    {
+        const int bitOffset = i * bitsPerIndex;
+        m_data[bitOffset >> 3] |= static_cast<uint8_t>(lookup[blockIDs[i]] << (bitOffset & 7));
+    }
+}
+
+void VoxelPaletteStorage::set(int index, uint8_t blockID)
+{
+    if (get(index) == blockID)
+        return;
+
+    if (m_bitsPerIndex == 8)
+    {
+        m_data[index] = blockID;
+        return;
+    }
+
+    if (m_bitsPerIndex > 0)
+    {
+        // Existing palette entry, or a free slot at the current width
+        int paletteIndex = -1;
+        for (int i = 0; i < m_paletteSize; ++i)
+        {
+            if (m_palette[i] == blockID)
+            {
+                paletteIndex = i;
+                break;
+            }
+        }
+        if (paletteIndex < 0 && m_paletteSize < (1 << m_bitsPerIndex))
+        {
+            paletteIndex = m_paletteSize;
+            m_palette[m_paletteSize++] = blockID;
+        }
+
+        if (paletteIndex >= 0)
+        {
+            const int bitOffset = index * m_bitsPerIndex;
+            const uint8_t mask = static_cast<uint8_t>(((1u << m_bitsPerIndex) - 1u) << (bitOffset & 7));
+            uint8_t& byte = m_data[bitOffset >> 3];
+            byte = static_cast<uint8_t>((byte & ~mask) | (paletteIndex << (bitOffset & 7)));
+            return;
+        }
+    }
+
+    // Promote: palette is full (or chunk was uniform) - repack one tier wider
+    std::array<uint8_t, VOLUME> decoded;
+    copyTo(decoded.data());
+    decoded[index] = blockID;
+
+    uint8_t palette[17];
+    int paletteSize = 0;
+    if (m_bitsPerIndex == 0)
+    {
+        palette[paletteSize++] = m_uniformValue;
+    }
+    else
+    {
+        for (int i = 0; i < m_paletteSize; ++i)
+            palette[paletteSize++] = m_palette[i];
+    }
+    palette[paletteSize++] = blockID;
+
+    encode(decoded.data(), bitsForPaletteSize(paletteSize), palette, paletteSize);
+}
+
+void VoxelPaletteStorage::assign(const uint8_t* blockIDs)
+{
+    bool seen[256] = {};
+    uint8_t palette[17];
+    int paletteSize = 0;
+    for (int i = 0; i < VOLUME && paletteSize <= 16; ++i)
+    {
+        if (!seen[blockIDs[i]])
+        {
+            seen[blockIDs[i]] = true;
+            palette[paletteSize++] = blockIDs[i];
+        }
+    }
+
+    encode(blockIDs, bitsForPaletteSize(paletteSize), palette, paletteSize);
+}
+
+void VoxelPaletteStorage::copyTo(uint8_t* outBlockIDs) const
+{
+    if (m_bitsPerIndex == 0)
+    {
+        std::memset(outBlockIDs, m_uniformValue, VOLUME);
+        return;
+    }
+    if (m_bitsPerIndex == 8)
+    {
+        std::memcpy(outBlockIDs, m_data.data(), VOLUME);
+        return;
+    }
+    for (int i = 0; i < VOLUME; ++i)
+        outBlockIDs[i] = get(i);
+}
+
+void VoxelPaletteStorage::fill(uint8_t blockID)
+{
+    encode(nullptr, 0, &blockID, 1);
+}
+
+void VoxelPaletteStorage::compact()
+{
+    if (m_bitsPerIndex == 0)
+        return;
+
+    std::array<uint8_t, VOLUME> decoded;
+    copyTo(decoded.data());
+    assign(decoded.data());
+}
+
+size_t VoxelPaletteStorage::getMemoryUsage() const
+{
+    return m_data.capacity();
+}
@@ -0,0 +1,64 @@
+// VoxelPaletteStorage.h - Palette-compressed block storage for one 16x16x16 chunk
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Storage tiers (promoted transparently on write, demoted by compact()):
+//   0 bits - uniform chunk, single block ID, zero heap allocation
+//   1/2/4  - packed palette indices into a fixed 2/4/16-entry palette
+//   8 bits - raw block IDs (palette would not save anything)
+// Not internally synchronized - same contract as the plain array it replaces.
+class VoxelPaletteStorage
+{
+   public:
+    static constexpr int VOLUME = 16 * 16 * 16;
+
+    VoxelPaletteStorage() = default;  // Uniform air
+
+    uint8_t get(int index) const
+    {
+        switch (m_bitsPerIndex)
+        {
+            case 0:
+                return m_uniformValue;
+            case 8:
+                return m_data[index];
+            default:
+            {
+                const int bitOffset = index * m_bitsPerIndex;
+                const uint8_t mask = static_cast<uint8_t>((1u << m_bitsPerIndex) - 1u);
+                return m_palette[(m_data[bitOffset >> 3] >> (bitOffset & 7)) & mask];
+            }
+        }
+    }
+
+    void set(int index, uint8_t blockID);
+
+    // Bulk access (network serialization)
+    void assign(const uint8_t* blockIDs);    // VOLUME bytes, packs at the smallest width
+    void copyTo(uint8_t* outBlockIDs) const; // VOLUME bytes
+
+    // Reset to a single block ID (frees all packed data)
+    void fill(uint8_t blockID);
+
+    // Drop unused palette entries and repack at the smallest width
+    void compact();
+
+    bool isUniform() const { return m_bitsPerIndex == 0; }
+    uint8_t getUniformValue() const { return m_uniformValue; }
+    int getBitsPerIndex() const { return m_bitsPerIndex; }
+    size_t getMemoryUsage() const;  // Heap bytes held (packed data)
+
+   private:
+    uint8_t m_bitsPerIndex = 0;
+    uint8_t m_uniformValue = 0;
+    uint8_t m_paletteSize = 0;
+    std::array<uint8_t, 16> m_palette{};  // Palette index -> block ID (1/2/4-bit tiers)
+    std::vector<uint8_t> m_data;          // Packed indices, or raw IDs at 8 bits
+
+    static uint8_t bitsForPaletteSize(int paletteSize);
+    void encode(const uint8_t* blockIDs, uint8_t bitsPerIndex, const uint8_t* palette, int paletteSize);
+};
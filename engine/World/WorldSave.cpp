@@ -0,0 +1,466 @@
+// WorldSave.cpp - Persistent world: island records + one region file per island
+#include "WorldSave.h"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <shared_mutex>
+
+#include "IslandChunkSystem.h"
+#include "VoxelAccessor.h"
+#include "../Core/JobSystem.h"
+#include "../Profiling/Profiler.h"
+
+namespace
+{
+constexpr char WORLD_MAGIC[4] = {'I', 'W', 'L', 'D'};
+constexpr uint32_t WORLD_VERSION = 1;
+
+struct WorldHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t islandCount;
+    float playerSpawn[3];
+};
+static_assert(sizeof(WorldHeader) == 24, "WorldHeader is an on-disk layout");
+
+struct IslandRecord
+{
+    uint32_t islandID;
+    float physicsCenter[3];
+    float velocity[3];
+    float rotation[3];
+    float angularVelocity[3];
+    uint32_t flags;           // ISLAND_NOT_GENERATED: no chunks yet, generate from seed + radius
+    uint32_t generationSeed;
+    float generationRadius;
+};
+static_assert(sizeof(IslandRecord) == 64, "IslandRecord is an on-disk layout");
+constexpr uint32_t ISLAND_NOT_GENERATED = 1u << 0;
+
+void storeVec3(float* out, const Vec3& v)
+{
+    out[0] = v.x;
+    out[1] = v.y;
+    out[2] = v.z;
+}
+
+Vec3 loadVec3(const float* in)
+{
+    return Vec3(in[0], in[1], in[2]);
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+}  // namespace
+
+WorldSave::WorldSave(const std::string& directory) : m_directory(directory)
+{
+}
+
+bool WorldSave::exists() const
+{
+    std::error_code error;
+    return std::filesystem::exists(worldFilePath(), error);
+}
+
+bool WorldSave::createDirectory() const
+{
+    std::error_code error;
+    std::filesystem::create_directories(m_directory, error);
+    if (error)
+    {
+        std::cerr << "❌ Cannot create world directory " << m_directory << ": " << error.message() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+std::string WorldSave::worldFilePath() const
+{
+    return (std::filesystem::path(m_directory) / "world.dat").string();
+}
+
+std::string WorldSave::regionFilePath(uint32_t islandID) const
+{
+    return (std::filesystem::path(m_directory) / ("island_" + std::to_string(islandID) + ".region")).string();
+}
+
+bool WorldSave::load(IslandChunkSystem& system, std::vector<uint32_t>& outIslandIDs, Vec3& outPlayerSpawn)
+{
+    PROFILE_SCOPE("WorldSave::load");
+    const auto start = std::chrono::steady_clock::now();
+
+    std::ifstream file(worldFilePath(), std::ios::binary);
+    if (!file)
+    {
+        std::cerr << "❌ Cannot open " << worldFilePath() << std::endl;
+        return false;
+    }
+
+    WorldHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!file || std::memcmp(header.magic, WORLD_MAGIC, sizeof(WORLD_MAGIC)) != 0 || header.version != WORLD_VERSION)
+    {
+        std::cerr << "❌ " << worldFilePath() << " is not a world file this build can read" << std::endl;
+        return false;
+    }
+
+    std::vector<IslandRecord> records(header.islandCount);
+    file.read(reinterpret_cast<char*>(records.data()), records.size() * sizeof(IslandRecord));
+    if (!file)
+    {
+        std::cerr << "❌ " << worldFilePath() << " is truncated" << std::endl;
+        return false;
+    }
+
+    outPlayerSpawn = loadVec3(header.playerSpawn);
+
+    size_t storedChunks = 0;
+    uint64_t mappedBytes = 0;
+    for (const IslandRecord& record : records)
+    {
+        const uint32_t islandID = system.createIsland(loadVec3(record.physicsCenter), record.islandID);
+        if (FloatingIsland* island = system.getIsland(islandID))
+        {
+            island->setPose(loadVec3(record.physicsCenter), loadVec3(record.rotation));
+            island->velocity = loadVec3(record.velocity);
+            island->angularVelocity = loadVec3(record.angularVelocity);
+        }
+        if (record.flags & ISLAND_NOT_GENERATED)
+            system.deferIslandGeneration(islandID, record.generationSeed, record.generationRadius);
+
+        // Only the chunk table is read here - payloads stay on disk until paged in
+        IslandStore& store = m_islands[islandID];
+        if (!store.region.open(regionFilePath(islandID)))
+            std::cerr << "⚠️  Island " << islandID << " has no readable region file - it starts empty" << std::endl;
+        store.pendingChunks = store.region.getChunks().size();
+        
+        // Nothing is resident yet - the stored chunks give the island its bounds for streaming
+        std::vector<ChunkCoord> storedCoords;
+        storedCoords.reserve(store.pendingChunks);
+        for (const auto& [chunkCoord, stored] : store.region.getChunks())
+            storedCoords.push_back(chunkCoord);
+        system.growIslandBounds(islandID, storedCoords);
+
+        storedChunks += store.pendingChunks;
+        mappedBytes += store.region.getFileSize();
+        outIslandIDs.push_back(islandID);
+    }
+
+    std::cout << "💾 Loaded world '" << m_directory << "': " << records.size() << " islands, " << storedChunks
+              << " chunks on disk (" << (mappedBytes >> 20) << " MB mapped) in " << millisecondsSince(start) << "ms"
+              << std::endl;
+    return true;
+}
+
+bool WorldSave::isIslandResident(uint32_t islandID) const
+{
+    auto it = m_islands.find(islandID);
+    return it == m_islands.end() || it->second.pendingChunks == 0;
+}
+
+bool WorldSave::isChunkStored(uint32_t islandID, const ChunkCoord& chunkCoord) const
+{
+    auto it = m_islands.find(islandID);
+    return it != m_islands.end() && it->second.region.contains(chunkCoord);
+}
+
+bool WorldSave::hasStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord) const
+{
+    auto it = m_islands.find(islandID);
+    return it != m_islands.end() && it->second.region.contains(chunkCoord) && !it->second.resident.contains(chunkCoord);
+}
+
+bool WorldSave::readStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord, uint8_t* voxels) const
+{
+    return hasStoredChunk(islandID, chunkCoord) && m_islands.at(islandID).region.readChunk(chunkCoord, voxels);
+}
+
+size_t WorldSave::pageInChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    auto storeIt = m_islands.find(islandID);
+    if (storeIt == m_islands.end() || !storeIt->second.region.isOpen())
+        return 0;
+    IslandStore& store = storeIt->second;
+
+    PROFILE_SCOPE("WorldSave::pageInChunks");
+
+    std::vector<ChunkCoord> wanted;
+    for (const ChunkCoord& chunkCoord : chunkCoords)
+    {
+        if (store.region.contains(chunkCoord) && !store.resident.contains(chunkCoord))
+            wanted.push_back(chunkCoord);
+    }
+    if (wanted.empty())
+        return 0;
+
+    // Decode off-island in parallel (the mapping is read-only), then attach in one batch
+    const ChunkProfile profile = system.getChunkProfile();
+    std::vector<std::pair<ChunkCoord, std::unique_ptr<VoxelChunk>>> loaded(wanted.size());
+    std::vector<VoxelChunk*> decoded(wanted.size(), nullptr);
+    g_jobSystem.parallelFor(wanted.size(), [&](size_t i)
+    {
+        loaded[i].first = wanted[i];
+        uint8_t voxels[VoxelChunk::VOLUME];
+        if (!store.region.readChunk(wanted[i], voxels))
+            return;
+
+        auto chunk = std::make_unique<VoxelChunk>(profile);
+        chunk->setRawVoxelData(voxels, VoxelChunk::VOLUME);
+        chunk->markSaved();  // Identical to its stored copy
+        decoded[i] = chunk.get();
+        loaded[i].second = std::move(chunk);
+    });
+
+    system.attachChunksToIsland(islandID, loaded);
+
+    std::vector<std::pair<ChunkCoord, VoxelChunk*>> attached;
+    size_t unreadable = 0;
+    for (size_t i = 0; i < loaded.size(); ++i)
+    {
+        if (!decoded[i])
+        {
+            ++unreadable;  // Stays on disk, not resident - never overwritten by a save
+            continue;
+        }
+        store.resident.insert(loaded[i].first);
+        --store.pendingChunks;
+
+        // Still owned here = the island already had a live chunk at that coord, which wins
+        if (!loaded[i].second)
+            attached.emplace_back(loaded[i].first, decoded[i]);
+    }
+    if (unreadable > 0)
+        std::cerr << "⚠️  Island " << islandID << ": " << unreadable << " stored chunks could not be read" << std::endl;
+
+    system.meshAttachedChunks(islandID, attached);
+    return attached.size();
+}
+
+size_t WorldSave::evictChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords)
+{
+    PROFILE_SCOPE("WorldSave::evictChunks");
+
+    // Everything changed on the island goes to disk first (usually nothing, or one fresh island)
+    IslandStore& store = m_islands[islandID];
+    SaveStats stats;
+    if (!createDirectory() || !saveIsland(system, islandID, store, stats))
+        return 0;  // Nothing leaves memory that isn't safely stored
+
+    // Only cold chunks the region holds exactly as they are in memory
+    std::vector<ChunkCoord> evictable;
+    evictable.reserve(chunkCoords.size());
+    {
+        VoxelAccessor pin(system, islandID, VoxelAccessor::Mode::Read);
+        const FloatingIsland* island = pin.getIsland();
+        if (!island)
+            return 0;
+        for (const ChunkCoord& chunkCoord : chunkCoords)
+        {
+            auto it = island->coldChunks.find(chunkCoord);
+            if (it != island->coldChunks.end() && !it->second->unsavedChanges && store.resident.contains(chunkCoord))
+                evictable.push_back(chunkCoord);
+        }
+    }
+
+    const size_t evicted = system.dropColdChunks(islandID, evictable);
+
+    // Stored, not resident: pageIn brings them back, saves leave them alone
+    for (const ChunkCoord& chunkCoord : evictable)
+    {
+        store.resident.erase(chunkCoord);
+        ++store.pendingChunks;
+    }
+    return evicted;
+}
+
+bool WorldSave::save(IslandChunkSystem& system, const Vec3& playerSpawn)
+{
+    PROFILE_SCOPE("WorldSave::save");
+    const auto start = std::chrono::steady_clock::now();
+
+    if (!createDirectory())
+        return false;
+
+    std::vector<uint32_t> islandIDs;
+    islandIDs.reserve(system.getIslands().size());
+    for (const auto& entry : system.getIslands())
+        islandIDs.push_back(entry.first);
+
+    // Region files first - world.dat never names an island whose chunks aren't on disk yet
+    SaveStats stats;
+    bool ok = true;
+    for (uint32_t islandID : islandIDs)
+        ok = saveIsland(system, islandID, m_islands[islandID], stats) && ok;
+
+    ok = writeWorldFile(system, playerSpawn, stats.islands) && ok;
+
+    // Islands destroyed since the last save are gone from world.dat now - drop their regions
+    for (auto it = m_islands.begin(); it != m_islands.end();)
+    {
+        if (system.getIsland(it->first))
+        {
+            ++it;
+            continue;
+        }
+        it->second.region.close();
+        std::error_code error;
+        std::filesystem::remove(regionFilePath(it->first), error);
+        it = m_islands.erase(it);
+    }
+
+    stats.milliseconds = millisecondsSince(start);
+    m_lastSave = stats;
+    std::cout << "💾 World saved: " << stats.islands << " islands, " << stats.chunksWritten << " chunks written, "
+              << stats.chunksRemoved << " removed (" << (stats.bytesWritten >> 10) << " KB) in " << stats.milliseconds
+              << "ms" << std::endl;
+    return ok;
+}
+
+bool WorldSave::saveIsland(IslandChunkSystem& system, uint32_t islandID, IslandStore& store, SaveStats& stats)
+{
+    std::vector<std::pair<ChunkCoord, VoxelChunk*>> changed;
+    std::vector<std::pair<ChunkCoord, ColdChunk*>> changedCold;  // Compacted before they were saved
+    std::vector<ChunkCoord> removed;
+    {
+        VoxelAccessor pin(system, islandID, VoxelAccessor::Mode::Read);
+        const FloatingIsland* island = pin.getIsland();
+        if (!island)
+            return true;
+
+        for (const auto& [chunkCoord, chunk] : island->chunks)
+        {
+            if (chunk && chunk->hasUnsavedChanges())
+                changed.emplace_back(chunkCoord, chunk.get());
+        }
+        for (const auto& [chunkCoord, cold] : island->coldChunks)
+        {
+            if (cold->unsavedChanges)
+                changedCold.emplace_back(chunkCoord, cold.get());
+        }
+
+        // Resident chunks the island no longer has were removed (non-resident ones are just not loaded)
+        store.resident.forEach([&](const ChunkCoord& chunkCoord) {
+            if (!island->chunks.contains(chunkCoord) && !island->coldChunks.contains(chunkCoord))
+                removed.push_back(chunkCoord);
+        });
+    }
+
+    if (changed.empty() && changedCold.empty() && removed.empty() && store.region.isOpen())
+        return true;
+
+    // Encoding runs unpinned: this thread is the only one that writes voxels or removes chunks,
+    // so the pointers stay valid and the voxels stay put until the save returns
+    std::vector<RegionFile::Payload> written(changed.size() + changedCold.size());
+    std::vector<uint8_t> encoded(written.size(), 0);
+    g_jobSystem.parallelFor(written.size(), [&](size_t i)
+    {
+        uint8_t voxels[VoxelChunk::VOLUME];
+        if (i < changed.size())
+        {
+            changed[i].second->copyRawVoxelData(voxels);
+            written[i].chunkCoord = changed[i].first;
+        }
+        else
+        {
+            const auto& entry = changedCold[i - changed.size()];
+            if (!IslandChunkSystem::decodeColdChunk(*entry.second, voxels))
+                return;  // Keeps its unsaved flag
+            written[i].chunkCoord = entry.first;
+        }
+        RegionFile::encodeChunk(voxels, written[i].bytes);
+        encoded[i] = 1;
+    });
+
+    // A cold chunk that failed to decode has nothing to write
+    std::vector<RegionFile::Payload> payloads;
+    payloads.reserve(written.size());
+    for (size_t i = 0; i < written.size(); ++i)
+    {
+        if (encoded[i])
+            payloads.push_back(std::move(written[i]));
+    }
+    written.swap(payloads);
+
+    if (!store.region.commit(regionFilePath(islandID), written, removed))
+        return false;  // Chunks keep their unsaved flag - the next save retries them
+
+    for (const auto& entry : changed)
+    {
+        entry.second->markSaved();
+        store.resident.insert(entry.first);
+    }
+    for (size_t i = 0; i < changedCold.size(); ++i)
+    {
+        if (!encoded[changed.size() + i])
+            continue;
+        changedCold[i].second->unsavedChanges = false;
+        store.resident.insert(changedCold[i].first);
+    }
+    for (const ChunkCoord& chunkCoord : removed)
+        store.resident.erase(chunkCoord);
+
+    stats.chunksWritten += written.size();
+    stats.chunksRemoved += removed.size();
+    for (const RegionFile::Payload& payload : written)
+        stats.bytesWritten += payload.bytes.size();
+    return true;
+}
+
+bool WorldSave::writeWorldFile(const IslandChunkSystem& system, const Vec3& playerSpawn, size_t& outIslands) const
+{
+    std::vector<IslandRecord> records;
+    records.reserve(system.getIslands().size());
+    for (const auto& [islandID, island] : system.getIslands())
+    {
+        std::shared_lock<std::shared_mutex> islandLock(island.mutex);
+        IslandRecord record{};
+        record.islandID = islandID;
+        storeVec3(record.physicsCenter, island.getPhysicsCenter());
+        storeVec3(record.velocity, island.velocity);
+        storeVec3(record.rotation, island.getRotation());
+        storeVec3(record.angularVelocity, island.angularVelocity);
+        if (system.getDeferredGeneration(islandID, record.generationSeed, record.generationRadius))
+            record.flags |= ISLAND_NOT_GENERATED;
+        records.push_back(record);
+    }
+
+    WorldHeader header{};
+    std::memcpy(header.magic, WORLD_MAGIC, sizeof(WORLD_MAGIC));
+    header.version = WORLD_VERSION;
+    header.islandCount = static_cast<uint32_t>(records.size());
+    storeVec3(header.playerSpawn, playerSpawn);
+
+    // Written aside and renamed over, so a crash leaves the previous world.dat intact
+    const std::string path = worldFilePath();
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(IslandRecord));
+        file.flush();
+        if (!file)
+        {
+            std::cerr << "❌ Failed writing " << tempPath << std::endl;
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+    {
+        std::cerr << "❌ Cannot replace " << path << ": " << error.message() << std::endl;
+        return false;
+    }
+
+    outIslands = records.size();
+    return true;
+}
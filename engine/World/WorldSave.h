@@ -0,0 +1,86 @@
+// WorldSave.h - Persistent world: island records + one region file per island
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ChunkCoord.h"
+#include "IslandChunkSystem.h"
+#include "RegionFile.h"
+#include "../Math/Vec3.h"
+
+// <directory>/world.dat          - spawn point + every island's pose, velocity and (until a player
+//                                  first reaches it) generation seed
+// <directory>/island_<id>.region - that island's chunks (see RegionFile)
+//
+// load() recreates the islands and maps their region files without decoding a single chunk, so a
+// saved world is up in the time it takes to read the tables. Chunks are paged in on demand; only
+// paged-in (resident) chunks are compared against the live island when saving, so a chunk that was
+// never loaded is never rewritten or dropped. save() writes only chunks changed since they were last
+// saved or paged in.
+//
+// As the island system's stream source it is also where evicted chunks go: cold (compacted) chunks
+// long out of every player's reach are saved if changed, then dropped from memory until the working
+// set reaches them again. Cold chunks are saved like hot ones and count as resident.
+//
+// Not thread-safe: load, page-in, eviction and save all run on the thread that owns the island
+// system (the server tick thread). Page-in decodes and meshes on the job system and blocks until done.
+class WorldSave : public ChunkStreamSource
+{
+   public:
+    explicit WorldSave(const std::string& directory);
+
+    const std::string& getDirectory() const { return m_directory; }
+    bool exists() const;  // world.dat present
+
+    // Recreate every saved island (forced IDs) and map its region file
+    bool load(IslandChunkSystem& system, std::vector<uint32_t>& outIslandIDs, Vec3& outPlayerSpawn);
+
+    // Decode + attach stored chunks that aren't resident yet; returns how many were attached
+    size_t pageInChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords);
+    bool isIslandResident(uint32_t islandID) const;
+    bool isChunkStored(uint32_t islandID, const ChunkCoord& chunkCoord) const;
+
+    // ChunkStreamSource
+    size_t loadChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords) override
+    {
+        return pageInChunks(system, islandID, chunkCoords);
+    }
+    size_t evictChunks(IslandChunkSystem& system, uint32_t islandID, const std::vector<ChunkCoord>& chunkCoords) override;
+    bool hasStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord) const override;
+    bool readStoredChunk(uint32_t islandID, const ChunkCoord& chunkCoord, uint8_t* voxels) const override;
+
+    // World record plus the changed chunks of every island in the system
+    bool save(IslandChunkSystem& system, const Vec3& playerSpawn);
+
+    struct SaveStats
+    {
+        size_t islands = 0;
+        size_t chunksWritten = 0;
+        size_t chunksRemoved = 0;
+        uint64_t bytesWritten = 0;
+        double milliseconds = 0.0;
+    };
+    const SaveStats& getLastSaveStats() const { return m_lastSave; }
+
+   private:
+    struct IslandStore
+    {
+        RegionFile region;
+        ChunkCoordSet resident;  // Stored chunks the live island owns (paged in or saved from memory)
+        size_t pendingChunks = 0;  // Stored but never paged in
+    };
+
+    bool createDirectory() const;
+    std::string worldFilePath() const;
+    std::string regionFilePath(uint32_t islandID) const;
+    bool writeWorldFile(const IslandChunkSystem& system, const Vec3& playerSpawn, size_t& outIslands) const;
+    bool saveIsland(IslandChunkSystem& system, uint32_t islandID, IslandStore& store, SaveStats& stats);
+
+    std::string m_directory;
+    std::unordered_map<uint32_t, IslandStore> m_islands;
+    SaveStats m_lastSave;
+};
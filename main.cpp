@@ -18,7 +18,24 @@ void printHelp()
               << std::endl;
     std::cout << "  --server:              Server-only mode (headless)" << std::endl;
     std::cout << "  --client <address>:    Connect to remote server" << std::endl;
+    std::cout << "  --world <dir>:         World save directory (default: saves/world)" << std::endl;
+    std::cout << "  --new-world:           Generate a new world even if the save directory has one"
+              << std::endl;
     std::cout << "  --debug:               Enable OpenGL debug output" << std::endl;
+    std::cout << "  --simple-mesher:       Mesh chunks one quad per face (reference mesher)" << std::endl;
+    std::cout << "  --greedy-mesher:       Mesh chunks with greedy quad merging" << std::endl;
+    std::cout << "  --verify-meshing:      Check every greedy mesh against the simple mesher"
+              << std::endl;
+    std::cout << "  --collision-faces:     Collide capsules with per-face collision meshes (reference path)"
+              << std::endl;
+    std::cout << "  --collision-probes:    Resolve player movement with per-axis probes instead of contacts"
+              << std::endl;
+    std::cout << "  --bench-island-locks:  Run the island lock contention benchmark and exit"
+              << std::endl;
+    std::cout << "  --bench-worldgen:      Benchmark island density evaluation (fixed seeds, checks"
+              << " output is unchanged) and exit" << std::endl;
+    std::cout << "  --bench-capsules:      Benchmark capsule collision, occupancy grid vs collision mesh,"
+              << " and exit" << std::endl;
     std::cout << "  --help:                Show this help" << std::endl;
     std::cout << std::endl;
     std::cout << "💡 All modes now use unified networking for consistent debugging" << std::endl;
@@ -28,6 +45,10 @@ void printHelp()
 #include "engine/Core/GameServer.h"
 #include "engine/Time/TimeEffects.h"
 #include "engine/Time/TimeManager.h"
+#include "engine/Input/PlayerController.h"
+#include "engine/Physics/PhysicsSystem.h"
+#include "engine/World/VoxelChunk.h"
+#include "engine/World/IslandSystemBenchmark.h"
 #include "engine/Profiling/DebugDiagnostics.h"
 #include "engine/Profiling/Profiler.h"
 
@@ -55,6 +76,20 @@ int main(int argc, char* argv[])
             printHelp();
             return 0;
         }
+        if (strcmp(argv[i], "--bench-island-locks") == 0)
+        {
+            IslandSystemBenchmark::runLockContention();
+            return 0;
+        }
+        if (strcmp(argv[i], "--bench-worldgen") == 0)
+        {
+            return IslandSystemBenchmark::runWorldGenDensity() ? 0 : 1;
+        }
+        if (strcmp(argv[i], "--bench-capsules") == 0)
+        {
+            IslandSystemBenchmark::runCapsuleCollision();
+            return 0;
+        }
     }
 
     // Parse command line arguments
@@ -63,6 +98,8 @@ int main(int argc, char* argv[])
     uint16_t serverPort = 12346;    // Changed from 7777 to a higher port number
     bool enableNetworking = false;  // Allow external connections in integrated mode
     bool enableDebug = false;       // Enable OpenGL debug output
+    std::string worldDirectory = "saves/world";  // Server-side world save
+    bool regenerateWorld = false;
 
     for (int i = 1; i < argc; i++)
     {
@@ -78,6 +115,35 @@ int main(int argc, char* argv[])
         {
             enableDebug = true;  // Enable OpenGL debug output
         }
+        else if (strcmp(argv[i], "--world") == 0 && i + 1 < argc)
+        {
+            worldDirectory = argv[i + 1];
+            i++;  // Skip next argument
+        }
+        else if (strcmp(argv[i], "--new-world") == 0)
+        {
+            regenerateWorld = true;
+        }
+        else if (strcmp(argv[i], "--simple-mesher") == 0)
+        {
+            VoxelChunk::setMeshingMode(VoxelChunk::MeshingMode::Simple);
+        }
+        else if (strcmp(argv[i], "--greedy-mesher") == 0)
+        {
+            VoxelChunk::setMeshingMode(VoxelChunk::MeshingMode::Greedy);
+        }
+        else if (strcmp(argv[i], "--verify-meshing") == 0)
+        {
+            VoxelChunk::setMeshVerification(true);  // Greedy vs simple surface check per chunk
+        }
+        else if (strcmp(argv[i], "--collision-faces") == 0)
+        {
+            g_physics.setCapsuleCollisionMode(PhysicsSystem::CapsuleCollisionMode::CollisionMesh);
+        }
+        else if (strcmp(argv[i], "--collision-probes") == 0)
+        {
+            PlayerController::setCollisionResolveMode(PlayerController::CollisionResolveMode::Probes);
+        }
         else if (strcmp(argv[i], "--client") == 0 && i + 1 < argc)
         {
             runMode = RunMode::CLIENT_ONLY;
@@ -113,6 +179,7 @@ int main(int argc, char* argv[])
             // Create and initialize server (ALWAYS with networking enabled for unified
             // architecture)
             GameServer server;
+            server.setWorldDirectory(worldDirectory, regenerateWorld);
             if (!server.initialize(60.0f, true, serverPort))
             {  // Force networking ON
                 std::cerr << "Failed to initialize game server!" << std::endl;
@@ -178,9 +245,10 @@ int main(int argc, char* argv[])
         {
             // Removed verbose debug output
 
-            // Create and initialize server with networking enabled
+            // Create and initialize server with networking enabled (headless: lean chunks)
             GameServer server;
-            if (!server.initialize(60.0f, true, serverPort))
+            server.setWorldDirectory(worldDirectory, regenerateWorld);
+            if (!server.initialize(60.0f, true, serverPort, true))
             {  // Enable networking
                 std::cerr << "Failed to initialize game server!" << std::endl;
                 return 1;
@@ -1,12 +1,15 @@
 // MDI Vertex Shader - Fetches transform from SSBO using gl_BaseInstance
 #version 460 core
 
-layout (location = 0) in vec3 aPosition;
-layout (location = 1) in vec3 aNormal;
-layout (location = 2) in vec2 aTexCoord;
-layout (location = 3) in vec2 aLightMapCoord;
-layout (location = 4) in float aFaceIndex;
-layout (location = 5) in float aBlockType;
+// Packed chunk vertex (Vertex in VoxelChunk.h):
+//   x = position 3x5 bits | texcoord 2x5 bits | face 3 bits | AO level 3 bits
+//   y = block type (bits 0-7)
+layout (location = 0) in uvec2 aPacked;
+
+const vec3 FACE_NORMALS[6] = vec3[6](
+    vec3(0.0, -1.0, 0.0), vec3(0.0, 1.0, 0.0),   // -Y, +Y
+    vec3(0.0, 0.0, -1.0), vec3(0.0, 0.0, 1.0),   // -Z, +Z
+    vec3(-1.0, 0.0, 0.0), vec3(1.0, 0.0, 0.0));  // -X, +X
 
 // SSBO containing all chunk transforms (indexed by gl_BaseInstance)
 layout (std430, binding = 0) readonly buffer ChunkTransforms {
@@ -29,6 +32,11 @@ void main()
     // Fetch this chunk's transform from SSBO using gl_BaseInstance
     mat4 modelMatrix = uTransforms[gl_BaseInstance];
     
+    // Unpack chunk-local position, face and block type
+    uint geometry = aPacked.x;
+    vec3 aPosition = vec3(geometry & 31u, (geometry >> 5) & 31u, (geometry >> 10) & 31u);
+    vec3 aNormal = FACE_NORMALS[min((geometry >> 25) & 7u, 5u)];
+    
     // Transform to world space
     vec4 worldPos = modelMatrix * vec4(aPosition, 1.0);
     WorldPos = worldPos.xyz;
@@ -40,8 +48,8 @@ void main()
     gl_Position = uProjection * uView * worldPos;
     
     // Pass through data
-    TexCoord = aTexCoord;
-    BlockType = aBlockType;
+    TexCoord = vec2((geometry >> 15) & 31u, (geometry >> 20) & 31u);
+    BlockType = float(aPacked.y & 255u);
     
     // Shadow space position
     LightSpacePos = uLightVP * worldPos;